@@ -537,6 +537,44 @@
 
 #endif // PIDTEMP
 
+/**
+ * Model Predictive Control for hotend temperature
+ *
+ * Use a thermal model of the hotend instead of PID. The model knows the heater power,
+ * the heat capacity of the heater block and the losses to the air, so it can work out
+ * the power needed to reach and hold the target. Known disturbances are fed forward:
+ * the part cooling fan and the filament flow of the moves waiting in the planner.
+ *
+ * Use 'M306 T' to measure the model constants. Place the nozzle just above the bed
+ * first, since the part cooling fan is run at full speed for part of the test.
+ * Set or report the constants with M306. Not compatible with PIDTEMP.
+ */
+//#define MPCTEMP
+#if ENABLED(MPCTEMP)
+  #define MPC_MAX BANG_MAX                            // (0..255) Current to nozzle while MPC is active.
+  #define MPC_HEATER_POWER { 40.0f }                  // (W) Heat cartridge powers.
+
+  #define MPC_INCLUDE_FAN                             // Model the part cooling fan speed?
+
+  // Measured physical constants from M306
+  #define MPC_BLOCK_HEAT_CAPACITY { 16.7f }           // (J/K) Heat block heat capacities.
+  #define MPC_SENSOR_RESPONSIVENESS { 0.22f }         // (K/s per ∆K) Rate of change of sensor temperature from heat block.
+  #define MPC_AMBIENT_XFER_COEFF { 0.068f }           // (W/K) Heat transfer coefficients from heat block to room air with fan off.
+  #if ENABLED(MPC_INCLUDE_FAN)
+    #define MPC_AMBIENT_XFER_COEFF_FAN255 { 0.097f }  // (W/K) Heat transfer coefficients from heat block to room air with fan on full.
+  #endif
+
+  // Filament heat capacity (J/K/mm)
+  #define FILAMENT_HEAT_CAPACITY_PERMM { 5.6e-3f }    // 0.0056 J/K/mm for 1.75mm PLA (0.0149 J/K/mm for 2.85mm PLA).
+
+  // Advanced options
+  #define MPC_FLOW_LOOKAHEAD 1.0f                     // (s) Queued moves used for the filament flow feedforward.
+  #define MPC_SMOOTHING_FACTOR 0.5f                   // (0.0...1.0) Noisy temperature sensors may need a lower value for stabilization.
+  #define MPC_MIN_AMBIENT_CHANGE 1.0f                 // (K/s) Modeled ambient temperature rate of change, when correcting model inaccuracies.
+  #define MPC_STEADYSTATE 0.5f                        // (K/s) Temperature change rate for steady state logic to be enforced.
+  #define MPC_TUNING_TEMP 200                         // (°C) M306 T heats the hotend to this temperature.
+#endif
+
 //===========================================================================
 //====================== PID > Bed Temperature Control ======================
 //===========================================================================
@@ -735,6 +773,10 @@
 // This will remove the need to poll the interrupt pins, saving many CPU cycles.
 #define ENDSTOP_INTERRUPTS_FEATURE
 
+// Read only the switches the current move is heading toward. Endstops for idle
+// axes and the far end of moving axes are skipped in every endstop update.
+//#define ENDSTOP_POLL_APPROACH_ONLY
+
 /**
  * Endstop Noise Threshold
  *
@@ -1340,6 +1382,19 @@
   // Probe along the Y axis, advancing X after each column
   //#define PROBE_Y_FIRST
 
+  /**
+   * Faster G29 grid probing
+   *  - Start at the grid corner nearest the probe and run the rows along
+   *    whichever axis gets through them quicker.
+   *  - Move quickly to just above the height of the previous point, then
+   *    probe slowly, skipping the fast probe of MULTIPLE_PROBING 2.
+   *  - Queue the raise and the travel to the next point as one path.
+   */
+  //#define FAST_GRID_PROBING
+  #if ENABLED(FAST_GRID_PROBING)
+    #define FAST_GRID_PROBING_MARGIN 1.0 // (mm) Approach height above the previous point
+  #endif
+
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
     // Beyond the probed grid, continue the implied tilt?
@@ -1373,6 +1428,17 @@
   #define UBL_MESH_EDIT_MOVES_Z     // Sophisticated users prefer no movement of nozzle
   #define UBL_SAVE_ACTIVE_ON_M500   // Save the currently active mesh in the current slot on M500
 
+  //#define UBL_ADAPTIVE_PROBING    // G29 P1 O probes a coarse grid and only refines where the bed isn't flat
+  #if ENABLED(UBL_ADAPTIVE_PROBING)
+    #define UBL_ADAPTIVE_STRIDE 2       // Spacing of the coarse grid, in mesh points
+    #define UBL_ADAPTIVE_THRESHOLD 0.02 // (mm) Plane-fit residual above which in-between points are probed
+  #endif
+
+  //#define UBL_PRINT_AREA_PROBING  // G29 P1 N re-probes only the mesh points under the SD job's ;MINX/;MINY/;MAXX/;MAXY header
+  #if ENABLED(UBL_PRINT_AREA_PROBING)
+    #define UBL_PRINT_AREA_MARGIN 10    // (mm) Extra area to probe around the job's extents
+  #endif
+
   //#define UBL_Z_RAISE_WHEN_OFF_MESH 2.5 // When the nozzle is off the mesh, this value is used
                                           // as the Z-Height correction value.
 
@@ -1689,6 +1755,9 @@
  * View the current statistics with M78.
  */
 #define PRINTCOUNTER //MFD: enabled this
+#if ENABLED(PRINTCOUNTER)
+  //#define PRINTCOUNTER_JOB_LOG  // Append a compact record of each job to JOBLOG.BIN on the SD card. View with 'M78 H'.
+#endif
 
 /**
  * Password
@@ -2420,6 +2489,15 @@
   #define NEOPIXEL_BRIGHTNESS 127  // Initial brightness (0-255)
   //#define NEOPIXEL_STARTUP_TEST  // Cycle through colors at startup
 
+  // Send color changes to the strip from the idle loop, no more often than
+  // NEOPIXEL_SHOW_INTERVAL, instead of on every change. Interrupts are off
+  // while the strip is sent, so this limits how often the steppers wait.
+  //#define NEOPIXEL_DEFERRED_SHOW
+  #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+    #define NEOPIXEL_SHOW_INTERVAL  50 // (ms) Shortest time between strip updates
+    #define NEOPIXEL_FADE_TIME     500 // (ms) Fade between whole-strip colors. 0 to disable.
+  #endif
+
   // Use a single Neopixel LED for static (background) lighting
   //#define NEOPIXEL_BKGD_LED_INDEX  0               // Index of the LED to use
   //#define NEOPIXEL_BKGD_COLOR { 255, 255, 255, 0 } // R, G, B, W
@@ -875,6 +875,11 @@
   // to reduce print artifacts. (Enabling this is costly in memory and computation!)
   //#define BACKLASH_SMOOTHING_MM 3 // (mm)
 
+  // Take up backlash with a short move of its own, planned together with the
+  // moves around it, instead of adding steps to the move that reverses.
+  // Not compatible with BACKLASH_SMOOTHING_MM.
+  //#define BACKLASH_TAKEUP_MOVE
+
   // Add runtime configuration and tuning of backlash values (M425)
   #define BACKLASH_GCODE  //MFD: enabled this
 
@@ -1410,6 +1415,8 @@
   //#define DGUS_SERIAL_STATS_RX_BUFFER_OVERRUNS  // Fix Rx overrun situation (Currently only for AVR)
 
   #define DGUS_UPDATE_INTERVAL_MS  500    // (ms) Interval between automatic screen updates
+  //#define DGUS_UPDATE_TX_BUDGET   96    // (bytes) Max data queued for the display per screen update
+  //#define DGUS_VP_CACHE_SIZE      32    // Remember values sent to this many VPs and skip unchanged writes. 0 to disable.
 
   #if EITHER(DGUS_LCD_UI_FYSETC, DGUS_LCD_UI_HIPRECY)
     #define DGUS_PRINT_FILENAME           // Display the filename during printing
@@ -1573,6 +1580,7 @@
 #define BABYSTEPPING
 #if ENABLED(BABYSTEPPING)
   //#define INTEGRATED_BABYSTEPPING         // EXPERIMENTAL integration of babystepping into the Stepper ISR
+  //#define BABYSTEP_PLANNED                // Add babysteps to the planner's blocks instead of stepping them in an ISR
   #define BABYSTEP_WITHOUT_HOMING  //MFD: enabled this
   #define BABYSTEP_XY              //MFD: enabled this       // Also enable X/Y Babystepping. Not supported on DELTA!
   #define BABYSTEP_INVERT_Z true           // Change if Z babysteps should go the other way
@@ -1691,6 +1699,24 @@
 
 #endif
 
+/**
+ * Job Start Scheduler
+ *
+ * Add M199 to start a job without idling at the heaters. Homing, mesh probing
+ * and the travel to the purge position all run while the hotend and bed warm up.
+ * The hotend is held at JOB_START_PROBE_TEMP or below until probing is done so
+ * the nozzle doesn't ooze onto the bed. Use in place of M190/M109/G28/G29:
+ *
+ *   M199 S<hotend> B<bed> [P0 to skip probing]
+ */
+//#define JOB_START_SCHEDULER
+#if ENABLED(JOB_START_SCHEDULER)
+  #define JOB_START_PROBE_TEMP 150          // (°C) Hotend temperature limit while probing
+  #define JOB_START_PROBE_GCODE "G29"       // Probing command(s). e.g., "G29 P1\nG29 A" for UBL
+  //#define JOB_START_PROBE_COLD_BED        // Probe without waiting for the bed to reach temperature
+  #define JOB_START_PURGE_POS { 5, 5, 5 }   // (mm) Where to wait for the final few degrees
+#endif
+
 /**
  * Thermal Probe Compensation
  * Probe measurements are adjusted to compensate for temperature distortion.
@@ -1771,6 +1797,20 @@
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
 #define BEZIER_CURVE_SUPPORT
 
+/**
+ * G1 Move Coalescing
+ *
+ * Look ahead in the command queue and fold consecutive G1 moves into one
+ * planner block when they lie on a straight line and share the same feedrate
+ * and extrusion ratio. Slicers often emit long runs of tiny collinear moves
+ * that would otherwise fill the planner buffer and starve the lookahead.
+ * Only plain G1 X Y Z E F commands are joined.
+ */
+//#define G1_MOVE_COALESCING
+#if ENABLED(G1_MOVE_COALESCING)
+  #define COALESCE_MAX_DEVIATION 0.005  // (mm) Max distance of each joined point from the line it's folded into
+#endif
+
 /**
  * Direct Stepping
  *
@@ -1891,6 +1931,16 @@
 // Add M575 G-code to change the baud rate
 //#define BAUD_RATE_GCODE
 
+/**
+ * Serial DMA (STM32F1/F4 with the STM32 HAL)
+ * Receive into a circular DMA buffer and transmit by DMA instead of taking an
+ * interrupt for every byte. The EMERGENCY_PARSER scans each received chunk.
+ * The RX buffer is overwritten if the host outruns it, so leave flow control
+ * to the host 'ok' and use RX_BUFFER_SIZE >= 256 at high baud rates.
+ * Check that the port's DMA streams aren't used by a TFT, touch or SDIO.
+ */
+//#define SERIAL_DMA
+
 #if ENABLED(SDSUPPORT)
   // Enable this option to collect and display the maximum
   // RX queue usage after transferring a file to SD.
@@ -1969,6 +2019,7 @@
   #define RETRACT_RECOVER_LENGTH_SWAP 0   // (mm) Default additional swap recover length (added to retract length on recover from toolchange)
   #define RETRACT_RECOVER_FEEDRATE 8      // (mm/s) Default feedrate for recovering from retraction
   #define RETRACT_RECOVER_FEEDRATE_SWAP 8 // (mm/s) Default feedrate for recovering from swap retraction
+  //#define FWRETRACT_COMBINED_HOP      // Retract and Z-raise in one block, and lower and recover in one block
   #if ENABLED(MIXING_EXTRUDER)
     //#define RETRACT_SYNC_MIXING         // Retract and restore all mixing steppers simultaneously
   #endif
@@ -1987,6 +2038,29 @@
     //#define EVENT_GCODE_AFTER_TOOLCHANGE "G12X"   // Extra G-code to run after tool-change
   #endif
 
+  /**
+   * Queue the Z raise, park, swap and return moves of a tool-change
+   * behind the moves already in the planner instead of waiting for each
+   * one to finish. Motion only stops where a servo, solenoid, fan or
+   * stepper switch needs it. Not for DELTA or SCARA.
+   */
+  //#define TOOLCHANGE_QUEUED_MOVES
+
+  /**
+   * Preheat the next tool ahead of its tool-change. After a tool-change the
+   * old tool waits at a standby temperature. The next T command is found in
+   * the command queue or, when printing from SD, further along the file, and
+   * its tool is heated just in time for the swap using a heating rate learned
+   * from each hotend. Requires more than one hotend.
+   */
+  //#define TOOLCHANGE_PREHEAT
+  #if ENABLED(TOOLCHANGE_PREHEAT)
+    #define TOOLCHANGE_PREHEAT_STANDBY_DROP  50  // (°C) Standby temperature below the print temperature
+    #define TOOLCHANGE_PREHEAT_RATE         1.5  // (°C/s) Initial heating rate, learned while printing
+    #define TOOLCHANGE_PREHEAT_MARGIN        10  // (s) Extra time to settle before the swap
+    #define TOOLCHANGE_PREHEAT_HORIZON      300  // (s) How far ahead to look in an SD file
+  #endif
+
   /**
    * Retract and prime filament on tool-change to reduce
    * ooze and stringing and to get cleaner transitions.
@@ -2448,6 +2522,7 @@
    * for error conditions like overtemperature and short to ground.
    * To manage over-temp Marlin can decrease the driver current until the error condition clears.
    * Other detected conditions can be used to stop the current print.
+   * Drivers are polled one per idle() call so slow UART reads don't stall the planner.
    * Relevant G-codes:
    * M906 - Set or get motor current in milliamps using axis codes X, Y, Z, E. Report values if no axis codes given.
    * M911 - Report stepper driver overtemperature pre-warn condition.
@@ -2983,6 +3058,23 @@
        */
       //#define LASER_POWER_INLINE_CONTINUOUS
 
+      /**
+       * Raster engraving with 'G7 X Y [F] D<hex>'
+       *
+       * A G7 line carries one byte of power per pixel, spread evenly over the
+       * move. All pixels ride in a single planner block and the stepper ISR
+       * switches the power at each pixel boundary, so bitmap lines stream at
+       * full feedrate instead of needing one G1 per run of equal pixels.
+       * Pixel values scale the inline power set with 'M3 S<power> I'.
+       *
+       * A block reserves room for LASER_RASTER_MAX_PIXELS in every buffer slot.
+       * MAX_CMD_SIZE also limits the pixels per line (two hex digits each).
+       */
+      //#define LASER_RASTER
+      #if ENABLED(LASER_RASTER)
+        #define LASER_RASTER_MAX_PIXELS 32  // Pixels carried by one G7 line (1-255)
+      #endif
+
     #else
 
       #define SPINDLE_LASER_POWERUP_DELAY     50 // (ms) Delay to allow the spindle/laser to come up to speed/power
@@ -3428,6 +3520,10 @@
   // G-code to execute when MMU2 F.I.N.D.A. probe detects filament runout
   #define MMU2_FILAMENT_RUNOUT_SCRIPT "M600"
 
+  // Return from T0-T4 as soon as the MMU has the command, letting travel moves run
+  // while the selector moves. Any other command waits for the change to finish.
+  //#define MMU2_ASYNC_TOOL_CHANGE
+
   // Add an LCD menu for MMU2
   //#define MMU2_MENUS
   #if ENABLED(MMU2_MENUS)
@@ -3527,3 +3623,12 @@
 
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
+
+//
+// M936 - Trace stepper ISR timing, block boundaries and temperature ISR
+// into a RAM ring buffer. Decode the dump with buildroot/share/scripts/stepper_trace.py
+//
+//#define STEPPER_TRACE
+#if ENABLED(STEPPER_TRACE)
+  #define STEPPER_TRACE_SIZE 256  // Records kept (8 bytes each). Power of 2.
+#endif
@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "../../../inc/MarlinConfig.h"
+
+#include "BedSurface.h"
+
+BedSurface::BedSurface(const char *filename) {
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream row(line);
+    std::vector<double> values;
+    double z;
+    while (row >> z) values.push_back(z);
+    if (values.size()) {
+      if (grid.size() && values.size() != grid[0].size()) {
+        printf("%s: rows must all be the same length\n", filename);
+        grid.clear();
+        return;
+      }
+      grid.push_back(values);
+    }
+  }
+}
+
+double BedSurface::height(double x, double y) const {
+  if (grid.empty()) return 0;
+
+  const size_t rows = grid.size(), cols = grid[0].size();
+
+  // Position in grid cells, clamped to the edges
+  const double gx = cols > 1 ? constrain((x - (X_MIN_POS)) / (X_MAX_POS - (X_MIN_POS)), 0.0, 1.0) * (cols - 1) : 0,
+               gy = rows > 1 ? constrain((y - (Y_MIN_POS)) / (Y_MAX_POS - (Y_MIN_POS)), 0.0, 1.0) * (rows - 1) : 0;
+  const size_t cx = _MIN(size_t(gx), cols > 1 ? cols - 2 : 0),
+               cy = _MIN(size_t(gy), rows > 1 ? rows - 2 : 0),
+               nx = _MIN(cx + 1, cols - 1),
+               ny = _MIN(cy + 1, rows - 1);
+  const double fx = gx - cx, fy = gy - cy,
+               z0 = grid[cy][cx] + (grid[cy][nx] - grid[cy][cx]) * fx,
+               z1 = grid[ny][cx] + (grid[ny][nx] - grid[ny][cx]) * fx;
+  return z0 + (z1 - z0) * fy;
+}
+
+#endif // __PLAT_LINUX__
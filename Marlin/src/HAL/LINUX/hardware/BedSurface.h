@@ -0,0 +1,39 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <vector>
+
+/**
+ * Simulated bed height, in mm above the Z endstop plane.
+ * Loaded from a text file of whitespace-separated heights, one row per line,
+ * the first row at Y_MIN_POS and the first column at X_MIN_POS, spread evenly
+ * over the bed. Without a file the bed is flat.
+ */
+class BedSurface {
+public:
+  BedSurface(const char *filename);
+  double height(double x, double y) const;
+
+private:
+  std::vector<std::vector<double>> grid;
+};
@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include <iostream>
+#include "IOLoggerTrace.h"
+
+IOLoggerTrace::IOLoggerTrace(std::string filename) : head(0), count(0), dropped(0) {
+  file.open(filename, std::ios::binary);
+  // Timestamps are microseconds; this logger has no stepper timer rate
+  const trace_record_t header = { 1000000UL, TRACE_HEADER, TRACE_FORMAT_VERSION, 0 };
+  file.write((const char*)&header, sizeof(header));
+}
+
+IOLoggerTrace::~IOLoggerTrace() {
+  flush();
+  file.close();
+}
+
+void IOLoggerTrace::log(GpioEvent ev) {
+  std::lock_guard<std::mutex> lock(vector_lock);
+  if (count == GPIO_LOG_SIZE) { dropped++; return; } // minimal impact to signal handler
+  trace_record_t &rec = events[(head + count) % GPIO_LOG_SIZE];
+  rec.time = uint32_t(ev.timestamp / 1000);
+  rec.event = TRACE_GPIO;
+  rec.flags = uint8_t(ev.event);
+  rec.value = trace_value(ev.pin_id);
+  count++;
+}
+
+void IOLoggerTrace::flush() {
+  { std::lock_guard<std::mutex> lock(vector_lock);
+    while (count) {
+      const std::size_t n = count < GPIO_LOG_SIZE - head ? count : GPIO_LOG_SIZE - head;
+      file.write((const char*)&events[head], n * sizeof(trace_record_t));
+      head = (head + n) % GPIO_LOG_SIZE;
+      count -= n;
+    }
+    if (dropped) {
+      std::cerr << "GPIO log dropped " << dropped << " events" << std::endl;
+      dropped = 0;
+    }
+  }
+  file.flush();
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <mutex>
+#include <fstream>
+#include "Gpio.h"
+#include "../../../core/trace.h"
+
+#ifndef GPIO_LOG_SIZE
+  #define GPIO_LOG_SIZE 4096 // Events held between flushes. Older events are dropped.
+#endif
+
+/**
+ * Log GPIO events as binary trace records (see core/trace.h)
+ * so STEPPER_TRACE captures and simulator logs share one decoder.
+ */
+class IOLoggerTrace: public IOLogger {
+public:
+  IOLoggerTrace(std::string filename);
+  virtual ~IOLoggerTrace();
+  void flush();
+  void log(GpioEvent ev);
+
+private:
+  std::ofstream file;
+  trace_record_t events[GPIO_LOG_SIZE];
+  std::size_t head, count, dropped;
+  std::mutex vector_lock;
+};
@@ -26,7 +26,8 @@
 #include "Clock.h"
 #include "LinearAxis.h"
 
-LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max) {
+LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type end_min, pin_type end_max)
+  : min_trigger(SIM_ENDSTOP_LATENCY_NS, SIM_ENDSTOP_NOISE) {
   enable_pin = enable;
   dir_pin = dir;
   step_pin = step;
@@ -47,7 +48,9 @@ LinearAxis::~LinearAxis() {
 }
 
 void LinearAxis::update() {
-
+  // Apply endstop changes that were waiting out their latency
+  if (min_trigger.update(Clock::nanos()) && Gpio::valid_pin(min_pin))
+    Gpio::pin_map[min_pin].value = min_trigger.state;
 }
 
 void LinearAxis::interrupt(GpioEvent ev) {
@@ -55,7 +58,9 @@ void LinearAxis::interrupt(GpioEvent ev) {
     if (ev.event == GpioEvent::RISE) {
       last_update = ev.timestamp;
       position += -1 + 2 * Gpio::pin_map[dir_pin].value;
-      Gpio::pin_map[min_pin].value = (position < min_position);
+      min_trigger.sample(position - min_position, ev.timestamp);
+      if (min_trigger.update(ev.timestamp) && Gpio::valid_pin(min_pin))
+        Gpio::pin_map[min_pin].value = min_trigger.state;
       //Gpio::pin_map[max_pin].value = (position > max_position);
       //if (position < min_position) printf("axis(%d) endstop : pos: %d, mm: %f, min: %d\n", step_pin, position, position / 80.0, Gpio::pin_map[min_pin].value);
     }
@@ -23,6 +23,14 @@
 
 #include <chrono>
 #include "Gpio.h"
+#include "TriggerModel.h"
+
+#ifndef SIM_ENDSTOP_LATENCY_NS
+  #define SIM_ENDSTOP_LATENCY_NS 0 // Contact to output delay
+#endif
+#ifndef SIM_ENDSTOP_NOISE
+  #define SIM_ENDSTOP_NOISE 0      // (steps) Standard deviation of the trigger point
+#endif
 
 class LinearAxis: public Peripheral {
 public:
@@ -42,4 +50,6 @@ public:
   int32_t max_position;
   uint64_t last_update;
 
+  TriggerModel min_trigger;
+
 };
@@ -19,22 +19,15 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  *
  */
-#pragma once
+#ifdef __PLAT_LINUX__
 
-#include <mutex>
-#include <list>
-#include <fstream>
-#include "Gpio.h"
+#include <random>
+#include "TriggerModel.h"
 
-class IOLoggerCSV: public IOLogger {
-public:
-  IOLoggerCSV(std::string filename);
-  virtual ~IOLoggerCSV();
-  void flush();
-  void log(GpioEvent ev);
+double TriggerModel::gaussian() {
+  static std::default_random_engine generator;
+  static std::normal_distribution<double> distribution(0.0, 1.0);
+  return distribution(generator);
+}
 
-private:
-  std::ofstream file;
-  std::list<GpioEvent> events;
-  std::mutex vector_lock;
-};
+#endif // __PLAT_LINUX__
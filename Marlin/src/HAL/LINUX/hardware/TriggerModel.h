@@ -0,0 +1,59 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Switch model shared by the simulated endstops and probe.
+ * The trigger point wanders by 'noise' (standard deviation, in the caller's
+ * distance units) each time the switch is released, and the output follows
+ * the physical contact 'latency_ns' later.
+ */
+struct TriggerModel {
+  uint64_t latency_ns;
+  double noise;
+
+  double offset = 0;
+  bool contact = false, state = false;
+  uint64_t change_time = 0;
+
+  TriggerModel(uint64_t latency_ns = 0, double noise = 0) : latency_ns(latency_ns), noise(noise) {}
+
+  // Feed the distance left to the trigger point. Negative is past it.
+  void sample(double distance, uint64_t now) {
+    const bool c = distance + offset < 0;
+    if (c == contact) return;
+    contact = c;
+    change_time = now + latency_ns;
+    if (!c && noise) offset = gaussian() * noise;
+  }
+
+  // The switch output at 'now'. Returns true on the edge where it changes.
+  bool update(uint64_t now) {
+    if (state == contact || now < change_time) return false;
+    state = contact;
+    return true;
+  }
+
+  static double gaussian(); // Standard normal sample
+};
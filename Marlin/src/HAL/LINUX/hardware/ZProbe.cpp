@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../../inc/MarlinConfig.h"
+
+#if HAS_BED_PROBE
+
+#include "Clock.h"
+#include "ZProbe.h"
+
+static constexpr float steps_per_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT,
+                       probe_offset[] = NOZZLE_TO_PROBE_OFFSET;
+
+// Nozzle position in mm, taking the min endstop as the axis origin
+static double axis_mm(const LinearAxis &axis, const AxisEnum a, const double min_pos) {
+  return (axis.position - axis.min_position) / steps_per_mm[a] + min_pos;
+}
+
+ZProbe::ZProbe(pin_type probe, LinearAxis &x, LinearAxis &y, LinearAxis &z, const BedSurface &bed)
+  : probe_pin(probe), x_axis(x), y_axis(y), z_axis(z), bed(bed), trigger(SIM_PROBE_LATENCY_NS, SIM_PROBE_NOISE) {
+  Gpio::pin_map[probe_pin].value = Z_MIN_PROBE_ENDSTOP_INVERTING;
+}
+
+ZProbe::~ZProbe() {
+}
+
+void ZProbe::update() {
+  const uint64_t now = Clock::nanos();
+  const double px = axis_mm(x_axis, X_AXIS, X_MIN_POS) + probe_offset[X_AXIS],
+               py = axis_mm(y_axis, Y_AXIS, Y_MIN_POS) + probe_offset[Y_AXIS],
+               tip = axis_mm(z_axis, Z_AXIS, 0) + probe_offset[Z_AXIS],
+               surface = bed.height(px, py);
+
+  trigger.sample(tip - surface, now);
+  if (trigger.update(now)) {
+    Gpio::pin_map[probe_pin].value = trigger.state != Z_MIN_PROBE_ENDSTOP_INVERTING;
+    if (trigger.state && log.is_open())
+      log << now << ", " << px << ", " << py << ", " << surface << ", " << surface - tip << std::endl;
+  }
+}
+
+void ZProbe::interrupt(GpioEvent ev) {
+  // unused
+}
+
+#endif // HAS_BED_PROBE
+#endif // __PLAT_LINUX__
@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <fstream>
+#include "Gpio.h"
+#include "BedSurface.h"
+#include "LinearAxis.h"
+#include "TriggerModel.h"
+
+#ifndef SIM_PROBE_LATENCY_NS
+  #define SIM_PROBE_LATENCY_NS 200000 // Contact to output delay
+#endif
+#ifndef SIM_PROBE_NOISE
+  #define SIM_PROBE_NOISE 0.002       // (mm) Standard deviation of the trigger height
+#endif
+
+/**
+ * A probe riding at NOZZLE_TO_PROBE_OFFSET from the nozzle. It triggers
+ * when its tip reaches the simulated bed surface under it.
+ */
+class ZProbe: public Peripheral {
+public:
+  ZProbe(pin_type probe, LinearAxis &x, LinearAxis &y, LinearAxis &z, const BedSurface &bed);
+  virtual ~ZProbe();
+  void update();
+  void interrupt(GpioEvent ev);
+
+  pin_type probe_pin;
+  LinearAxis &x_axis, &y_axis, &z_axis;
+  const BedSurface &bed;
+  TriggerModel trigger;
+
+  // When open, each trigger is logged as: time (ns), x, y, bed height, overtravel (mm)
+  std::ofstream log;
+};
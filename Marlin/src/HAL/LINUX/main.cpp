@@ -31,9 +31,15 @@ extern void loop();
 #include <stdio.h>
 #include <stdarg.h>
 #include "../shared/Delay.h"
-#include "hardware/IOLoggerCSV.h"
+#include "hardware/IOLoggerTrace.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/BedSurface.h"
+#include "hardware/ZProbe.h"
+
+#ifndef SIM_BED_HEIGHT_MAP
+  #define SIM_BED_HEIGHT_MAP "bed_height_map.txt" // See BedSurface.h. Flat if missing.
+#endif
 
 // simple stdout / stdin implementation for fake serial port
 void write_serial_thread() {
@@ -61,13 +67,24 @@ void simulation_loop() {
   Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
   LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
   LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
-  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
+  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, TERN(Z_MIN_PROBE_USES_Z_MIN_ENDSTOP_PIN, P_NC, Z_MIN_PIN), Z_MAX_PIN);
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
 
+  #if HAS_BED_PROBE
+    BedSurface bed_surface(SIM_BED_HEIGHT_MAP);
+    ZProbe z_probe(TERN(Z_MIN_PROBE_USES_Z_MIN_ENDSTOP_PIN, Z_MIN_PIN, Z_MIN_PROBE_PIN), x_axis, y_axis, z_axis, bed_surface);
+  #endif
+
+  //#define PROBE_LOGGING // Log every probe trigger with the true bed height and overtravel
+
+  #if BOTH(HAS_BED_PROBE, PROBE_LOGGING)
+    z_probe.log.open("probe_log.csv");
+  #endif
+
   //#define GPIO_LOGGING // Full GPIO and Positional Logging
 
   #ifdef GPIO_LOGGING
-    IOLoggerCSV logger("all_gpio_log.csv");
+    IOLoggerTrace logger("all_gpio_log.trace"); // Decode with buildroot/share/scripts/stepper_trace.py
     Gpio::attachLogger(&logger);
 
     std::ofstream position_log;
@@ -85,6 +102,7 @@ void simulation_loop() {
     y_axis.update();
     z_axis.update();
     extruder0.update();
+    TERN_(HAS_BED_PROBE, z_probe.update());
 
     #ifdef GPIO_LOGGING
       if (x_axis.position != x || y_axis.position != y || z_axis.position != z) {
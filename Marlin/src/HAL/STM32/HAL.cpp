@@ -84,6 +84,11 @@ void HAL_init() {
   TERN_(EMERGENCY_PARSER, USB_Hook_init());
 }
 
+#if ENABLED(SERIAL_DMA)
+  // HAL idle task
+  void HAL_idletask() { serial_dma_service(); }
+#endif
+
 void HAL_clear_reset_source() { __HAL_RCC_CLEAR_RESET_FLAGS(); }
 
 uint8_t HAL_get_reset_source() {
@@ -171,6 +171,12 @@ extern uint16_t HAL_adc_result;
 // Enable hooks into  setup for HAL
 void HAL_init();
 
+#if ENABLED(SERIAL_DMA)
+  // Poll the serial DMA streams from idle()
+  #define HAL_IDLETASK 1
+  void HAL_idletask();
+#endif
+
 // Clear reset reason
 void HAL_clear_reset_source();
 
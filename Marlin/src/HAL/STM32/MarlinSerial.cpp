@@ -55,6 +55,9 @@
 
 void MarlinSerial::begin(unsigned long baud, uint8_t config) {
   HardwareSerial::begin(baud, config);
+  #if ENABLED(SERIAL_DMA)
+    if (dma_init()) return;
+  #endif
   // replace the IRQ callback with the one we have defined
   #if ENABLED(EMERGENCY_PARSER)
     _serial.rx_callback = _rx_callback;
@@ -85,4 +88,166 @@ void MarlinSerial::_rx_complete_irq(serial_t *obj) {
   }
 }
 
+#if ENABLED(SERIAL_DMA)
+
+  /**
+   * DMA mode
+   *
+   * RX runs as a circular DMA transfer straight into the core's RX buffer, so
+   * the write position is read from the DMA counter instead of being advanced
+   * by a per-byte interrupt. TX sends the largest contiguous run of the TX
+   * buffer per transfer. Both are serviced by polling from idle() and from
+   * the stream calls, so no interrupt vectors are taken from the core.
+   */
+
+  #define POLL_SERIAL_PORT(ser_num) MSerial ## ser_num .dma_poll()
+  #define POLL_SERIAL_PORT_EXP(ser_num) POLL_SERIAL_PORT(ser_num)
+
+  void serial_dma_service() {
+    #if defined(SERIAL_PORT) && SERIAL_PORT >= 0
+      POLL_SERIAL_PORT_EXP(SERIAL_PORT);
+    #endif
+    #if defined(SERIAL_PORT_2) && SERIAL_PORT_2 >= 0
+      POLL_SERIAL_PORT_EXP(SERIAL_PORT_2);
+    #endif
+    #if defined(DGUS_SERIAL_PORT) && DGUS_SERIAL_PORT >= 0
+      POLL_SERIAL_PORT_EXP(DGUS_SERIAL_PORT);
+    #endif
+  }
+
+  // DMA requests of each USART (RM0008 table 78, RM0090 tables 42/43)
+  bool MarlinSerial::dma_lookup() {
+    #ifdef STM32F1xx
+      #define DMA_MAP(U, RX, TX) if (_serial.uart == U) { dma_rx.Instance = RX; dma_tx.Instance = TX; return true; }
+      DMA_MAP(USART1, DMA1_Channel5, DMA1_Channel4);
+      DMA_MAP(USART2, DMA1_Channel6, DMA1_Channel7);
+      DMA_MAP(USART3, DMA1_Channel3, DMA1_Channel2);
+      #if defined(UART4) && defined(DMA2)
+        DMA_MAP(UART4, DMA2_Channel3, DMA2_Channel5);
+      #endif
+    #else
+      #define DMA_MAP(U, RX, TX, CH) if (_serial.uart == U) { dma_rx.Instance = RX; dma_tx.Instance = TX; dma_rx.Init.Channel = dma_tx.Init.Channel = CH; return true; }
+      DMA_MAP(USART1, DMA2_Stream5, DMA2_Stream7, DMA_CHANNEL_4);
+      DMA_MAP(USART2, DMA1_Stream5, DMA1_Stream6, DMA_CHANNEL_4);
+      DMA_MAP(USART3, DMA1_Stream1, DMA1_Stream3, DMA_CHANNEL_4);
+      #ifdef UART4
+        DMA_MAP(UART4, DMA1_Stream2, DMA1_Stream4, DMA_CHANNEL_4);
+      #endif
+      #ifdef UART5
+        DMA_MAP(UART5, DMA1_Stream0, DMA1_Stream7, DMA_CHANNEL_4);
+      #endif
+      #ifdef USART6
+        DMA_MAP(USART6, DMA2_Stream1, DMA2_Stream6, DMA_CHANNEL_5);
+      #endif
+    #endif
+    #undef DMA_MAP
+    return false;
+  }
+
+  bool MarlinSerial::dma_init() {
+    dma_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    dma_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+    dma_rx.Init.MemInc = DMA_MINC_ENABLE;
+    dma_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    dma_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    dma_rx.Init.Mode = DMA_CIRCULAR;
+    dma_rx.Init.Priority = DMA_PRIORITY_HIGH;
+    #ifdef STM32F4xx
+      dma_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    #endif
+    dma_tx.Init = dma_rx.Init;
+    dma_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    dma_tx.Init.Mode = DMA_NORMAL;
+    dma_tx.Init.Priority = DMA_PRIORITY_LOW;
+
+    if (!dma_lookup()) return false; // No DMA for this port, stay interrupt driven
+
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    #ifdef DMA2
+      __HAL_RCC_DMA2_CLK_ENABLE();
+    #endif
+    HAL_DMA_Init(&dma_rx);
+    HAL_DMA_Init(&dma_tx);
+
+    USART_TypeDef * const uart = _serial.uart;
+
+    // The core armed a per-byte RX interrupt in begin()
+    CLEAR_BIT(uart->CR1, USART_CR1_RXNEIE | USART_CR1_PEIE);
+    CLEAR_BIT(uart->CR3, USART_CR3_EIE);
+
+    _serial.rx_head = _serial.rx_tail = 0;
+    _serial.tx_head = _serial.tx_tail = 0;
+    tx_dma_len = 0;
+
+    HAL_DMA_Start(&dma_rx, (uint32_t)&uart->DR, (uint32_t)_serial.rx_buff, SERIAL_RX_BUFFER_SIZE);
+    SET_BIT(uart->CR3, USART_CR3_DMAR | USART_CR3_DMAT);
+
+    dma_active = true;
+    return true;
+  }
+
+  void MarlinSerial::dma_tx_start() {
+    const uint16_t tail = _serial.tx_tail;
+    tx_dma_len = (_serial.tx_head > tail ? _serial.tx_head : SERIAL_TX_BUFFER_SIZE) - tail;
+
+    __HAL_DMA_CLEAR_FLAG(&dma_tx, __HAL_DMA_GET_TC_FLAG_INDEX(&dma_tx));
+    __HAL_DMA_CLEAR_FLAG(&dma_tx, __HAL_DMA_GET_HT_FLAG_INDEX(&dma_tx));
+    __HAL_DMA_CLEAR_FLAG(&dma_tx, __HAL_DMA_GET_TE_FLAG_INDEX(&dma_tx));
+    #ifdef STM32F1xx
+      dma_tx.Instance->CNDTR = tx_dma_len;
+      dma_tx.Instance->CPAR = (uint32_t)&_serial.uart->DR;
+      dma_tx.Instance->CMAR = (uint32_t)&_serial.tx_buff[tail];
+    #else
+      __HAL_DMA_CLEAR_FLAG(&dma_tx, __HAL_DMA_GET_FE_FLAG_INDEX(&dma_tx));
+      __HAL_DMA_CLEAR_FLAG(&dma_tx, __HAL_DMA_GET_DME_FLAG_INDEX(&dma_tx));
+      dma_tx.Instance->NDTR = tx_dma_len;
+      dma_tx.Instance->PAR = (uint32_t)&_serial.uart->DR;
+      dma_tx.Instance->M0AR = (uint32_t)&_serial.tx_buff[tail];
+    #endif
+    __HAL_DMA_ENABLE(&dma_tx);
+  }
+
+  void MarlinSerial::dma_poll() {
+    if (!dma_active) return;
+
+    // Everything up to the DMA write position has arrived
+    const uint16_t head = (SERIAL_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&dma_rx)) % SERIAL_RX_BUFFER_SIZE;
+    #if ENABLED(EMERGENCY_PARSER)
+      for (uint16_t i = _serial.rx_head; i != head; i = (i + 1) % SERIAL_RX_BUFFER_SIZE)
+        emergency_parser.update(emergency_state, _serial.rx_buff[i]);
+    #endif
+    _serial.rx_head = head;
+
+    if (tx_dma_len) {
+      if (__HAL_DMA_GET_COUNTER(&dma_tx)) return; // Transfer still running
+      __HAL_DMA_DISABLE(&dma_tx);
+      _serial.tx_tail = (_serial.tx_tail + tx_dma_len) % SERIAL_TX_BUFFER_SIZE;
+      tx_dma_len = 0;
+    }
+    if (_serial.tx_head != _serial.tx_tail) dma_tx_start();
+  }
+
+  int MarlinSerial::available() { dma_poll(); return HardwareSerial::available(); }
+  int MarlinSerial::peek() { dma_poll(); return HardwareSerial::peek(); }
+  int MarlinSerial::read() { dma_poll(); return HardwareSerial::read(); }
+
+  size_t MarlinSerial::write(uint8_t c) {
+    if (!dma_active) return HardwareSerial::write(c);
+
+    const uint16_t i = (_serial.tx_head + 1) % SERIAL_TX_BUFFER_SIZE;
+    while (i == _serial.tx_tail) dma_poll(); // Buffer full, wait for the running transfer
+    _serial.tx_buff[_serial.tx_head] = c;
+    _serial.tx_head = i;
+    dma_poll();
+    return 1;
+  }
+
+  void MarlinSerial::flush() {
+    if (!dma_active) return HardwareSerial::flush();
+    while (tx_dma_len || _serial.tx_head != _serial.tx_tail) dma_poll();
+    while (!READ_BIT(_serial.uart->SR, USART_SR_TC)) { /* nada */ }
+  }
+
+#endif // SERIAL_DMA
+
 #endif // ARDUINO_ARCH_STM32 && !STM32GENERIC
@@ -40,13 +40,40 @@ public:
 
   void _rx_complete_irq(serial_t* obj);
 
+  #if ENABLED(SERIAL_DMA)
+    int available() override;
+    int peek() override;
+    int read() override;
+    void flush() override;
+    size_t write(uint8_t c) override;
+    using HardwareSerial::write;
+
+    // Pick up received data, run the emergency parser over it, restart TX
+    void dma_poll();
+  #endif
+
 protected:
   usart_rx_callback_t _rx_callback;
   #if ENABLED(EMERGENCY_PARSER)
     EmergencyParser::State emergency_state;
   #endif
+
+  #if ENABLED(SERIAL_DMA)
+    DMA_HandleTypeDef dma_rx, dma_tx;
+    bool dma_active = false;
+    uint16_t tx_dma_len = 0;  // Bytes in the running TX transfer
+
+    bool dma_init();
+    bool dma_lookup();
+    void dma_tx_start();
+  #endif
 };
 
+#if ENABLED(SERIAL_DMA)
+  // Poll the DMA of every MarlinSerial port in use
+  void serial_dma_service();
+#endif
+
 extern MarlinSerial MSerial1;
 extern MarlinSerial MSerial2;
 extern MarlinSerial MSerial3;
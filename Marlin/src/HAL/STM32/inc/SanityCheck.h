@@ -49,6 +49,10 @@
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4 hardware."
 #endif
 
+#if ENABLED(SERIAL_DMA) && !(defined(STM32F1xx) || defined(STM32F4xx))
+  #error "SERIAL_DMA is currently only supported on STM32F1 and STM32F4."
+#endif
+
 #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
   #error "SERIAL_STATS_MAX_RX_QUEUED is not supported on this platform."
 #elif ENABLED(SERIAL_STATS_DROPPED_RX)
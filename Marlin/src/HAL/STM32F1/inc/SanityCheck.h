@@ -33,6 +33,10 @@
   #error "Features requiring Hardware PWM (FAST_PWM_FAN, SPINDLE_LASER_FREQUENCY) are not yet supported on STM32F1."
 #endif
 
+#if ENABLED(SERIAL_DMA)
+  #error "SERIAL_DMA is not yet implemented for the STM32F1 (Maple) HAL. Use an STM32 HAL environment."
+#endif
+
 #if !defined(HAVE_SW_SERIAL) && HAS_TMC_SW_SERIAL
   #warning "With TMC2208/9 consider using SoftwareSerialM with HAVE_SW_SERIAL and appropriate SS_TIMER."
   #error "Missing SoftwareSerial implementation."
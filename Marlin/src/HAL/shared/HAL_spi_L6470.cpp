@@ -103,6 +103,8 @@ uint8_t L64XX_Marlin::transfer_single(uint8_t data, int16_t ss_pin) {
 uint8_t L64XX_Marlin::transfer_chain(uint8_t data, int16_t ss_pin, uint8_t chain_position) {
   uint8_t data_out = 0;
 
+  TERN_(MONITOR_L6470_DRIVER_STATUS, count_frame(L64XX::chain[0]));
+
   // first device in chain has data sent last
   extDigitalWrite(ss_pin, LOW);
 
@@ -134,6 +136,26 @@ void L64XX_Marlin::transfer(uint8_t L6470_buf[], const uint8_t length) {
   WRITE(L6470_CHAIN_SS_PIN, HIGH);
 }
 
+/**
+ * Full-duplex transfer of one frame to the whole chain.
+ * L6470_buf[n] holds the byte for chain position n and receives that device's reply.
+ * Returns false if set_directions() interrupted the frame.
+ */
+bool L64XX_Marlin::transfer_frame(uint8_t L6470_buf[], const uint8_t length) {
+  TERN_(MONITOR_L6470_DRIVER_STATUS, count_frame(length));
+
+  // First device in chain has its data sent last
+  WRITE(L6470_CHAIN_SS_PIN, LOW);
+  for (uint8_t i = length; !spi_abort && i >= 1; i--) {   // Send data unless aborted
+    DISABLE_ISRS();   // Disable interrupts during SPI transfer (can't allow partial command to chips)
+    L6470_buf[i] = L6470_SpiTransfer_Mode_3(L6470_buf[i]);
+    ENABLE_ISRS();    // Enable interrupts
+  }
+  WRITE(L6470_CHAIN_SS_PIN, HIGH);
+
+  return !spi_abort;
+}
+
 #pragma GCC reset_options
 
 #endif // HAS_L64XX
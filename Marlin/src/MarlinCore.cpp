@@ -185,6 +185,10 @@
   #include "feature/hotend_idle.h"
 #endif
 
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #include "feature/tool_preheat.h"
+#endif
+
 #if ENABLED(TEMP_STAT_LEDS)
   #include "feature/leds/tempstat.h"
 #endif
@@ -444,6 +448,7 @@ void startOrResumeJob() {
 
   inline void abortSDPrinting() {
     card.endFilePrint(TERN_(SD_RESORT, true));
+    TERN_(UBL_PRINT_AREA_PROBING, ubl.clear_print_area()); // Don't apply this job's area to the next one
     queue.clear();
     quickstop_stepper();
     print_job_timer.stop();
@@ -579,6 +584,8 @@ inline void manage_inactivity(const bool ignore_stepper_queue=false) {
 
   TERN_(HOTEND_IDLE_TIMEOUT, hotend_idle.check());
 
+  TERN_(TOOLCHANGE_PREHEAT, tool_preheat.update());
+
   #if ENABLED(EXTRUDER_RUNOUT_PREVENT)
     if (thermalManager.degHotend(active_extruder) > EXTRUDER_RUNOUT_MINTEMP
       && ELAPSED(ms, gcode.previous_move_ms + SEC_TO_MS(EXTRUDER_RUNOUT_SECONDS))
@@ -741,6 +748,9 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Update the Beeper queue
   TERN_(USE_BEEPER, buzzer.tick());
 
+  // Send NeoPixel changes to the strip
+  TERN_(NEOPIXEL_DEFERRED_SHOW, neo.update());
+
   // Handle UI input / draw events
   TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
 
@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * trace.h - Binary trace record format
+ *
+ * Shared by the STEPPER_TRACE ring buffer and the Linux HAL GPIO logger,
+ * and decoded on the host by buildroot/share/scripts/stepper_trace.py.
+ * Each record is 8 bytes, little-endian. A trace starts with a header
+ * record giving the timestamp rate and the stepper timer rate.
+ */
+
+#include <stdint.h>
+
+#define TRACE_FORMAT_VERSION 1
+
+enum TraceEvent : uint8_t {
+  TRACE_HEADER,         // time: Timestamp ticks per second, flags: Format version, value: Stepper timer rate (kHz)
+  TRACE_STEP_ISR,       // Stepper::isr() entry
+  TRACE_STEP_INTERVAL,  // Stepper::isr() exit. value: Ticks to the next ISR, flags: Loops taken
+  TRACE_BLOCK_START,    // New block picked up. value: Step events in the block
+  TRACE_BLOCK_END,      // Block finished
+  TRACE_TEMP_ENTER,     // Temperature::tick() entry
+  TRACE_TEMP_EXIT,      // Temperature::tick() exit
+  TRACE_GPIO            // Pin change (Linux HAL). value: Pin, flags: GpioEvent type
+};
+
+typedef struct {
+  uint32_t time;        // Timestamp, wrapping
+  uint8_t event,        // TraceEvent
+          flags;
+  uint16_t value;       // Saturated at 0xFFFF
+} __attribute__((__packed__)) trace_record_t;
+
+static_assert(sizeof(trace_record_t) == 8, "trace_record_t must be 8 bytes.");
+
+inline uint16_t trace_value(const uint32_t v) { return v > 0xFFFF ? 0xFFFF : v; }
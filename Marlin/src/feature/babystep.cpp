@@ -41,13 +41,17 @@ volatile int16_t Babystep::steps[BS_AXIS_IND(Z_AXIS) + 1];
 #endif
 int16_t Babystep::accum;
 
-void Babystep::step_axis(const AxisEnum axis) {
-  const int16_t curTodo = steps[BS_AXIS_IND(axis)]; // get rid of volatile for performance
-  if (curTodo) {
-    stepper.do_babystep((AxisEnum)axis, curTodo > 0);
-    if (curTodo > 0) steps[BS_AXIS_IND(axis)]--; else steps[BS_AXIS_IND(axis)]++;
+#if DISABLED(BABYSTEP_PLANNED)
+
+  void Babystep::step_axis(const AxisEnum axis) {
+    const int16_t curTodo = steps[BS_AXIS_IND(axis)]; // get rid of volatile for performance
+    if (curTodo) {
+      stepper.do_babystep((AxisEnum)axis, curTodo > 0);
+      if (curTodo > 0) steps[BS_AXIS_IND(axis)]--; else steps[BS_AXIS_IND(axis)]++;
+    }
   }
-}
+
+#endif
 
 void Babystep::add_mm(const AxisEnum axis, const float &mm) {
   add_steps(axis, mm * planner.settings.axis_steps_per_mm[axis]);
@@ -61,6 +65,7 @@ void Babystep::add_steps(const AxisEnum axis, const int16_t distance) {
   TERN_(BABYSTEP_DISPLAY_TOTAL, axis_total[BS_TOTAL_IND(axis)] += distance);
   TERN_(BABYSTEP_ALWAYS_AVAILABLE, gcode.reset_stepper_timeout());
   TERN_(INTEGRATED_BABYSTEPPING, if (has_steps()) stepper.initiateBabystepping());
+  TERN_(BABYSTEP_PLANNED, if (!planner.has_blocks_queued()) planner.buffer_babysteps()); // Else the next block takes them
 }
 
 #endif // BABYSTEPPING
@@ -67,16 +67,35 @@ public:
     return steps[BS_AXIS_IND(X_AXIS)] || steps[BS_AXIS_IND(Y_AXIS)] || steps[BS_AXIS_IND(Z_AXIS)];
   }
 
-  //
-  // Called by the Temperature or Stepper ISR to
-  // apply accumulated babysteps to the axes.
-  //
-  static inline void task() {
-    LOOP_LE_N(i, BS_AXIS_IND(Z_AXIS)) step_axis(BS_AXIS(i));
-  }
+  #if ENABLED(BABYSTEP_PLANNED)
+
+    //
+    // Called by the Planner to add accumulated
+    // babysteps to the next block it queues.
+    //
+    static inline int16_t planned_steps(const AxisEnum axis) {
+      if (BS_AXIS(BS_AXIS_IND(axis)) != axis) return 0;
+      const int16_t todo = steps[BS_AXIS_IND(axis)];
+      return (axis == Z_AXIS && BABYSTEP_INVERT_Z) ? -todo : todo;
+    }
+    static inline void clear_planned() {
+      LOOP_LE_N(i, BS_AXIS_IND(Z_AXIS)) steps[i] = 0;
+    }
+
+  #else
+
+    //
+    // Called by the Temperature or Stepper ISR to
+    // apply accumulated babysteps to the axes.
+    //
+    static inline void task() {
+      LOOP_LE_N(i, BS_AXIS_IND(Z_AXIS)) step_axis(BS_AXIS(i));
+    }
 
-private:
-  static void step_axis(const AxisEnum axis);
+  private:
+    static void step_axis(const AxisEnum axis);
+
+  #endif
 };
 
 extern Babystep babystep;
@@ -51,6 +51,22 @@
 
 Backlash backlash;
 
+uint8_t Backlash::last_direction_bits;
+
+#if ENABLED(BACKLASH_TAKEUP_MOVE)
+  xyz_long_t Backlash::pending{0};
+#endif
+
+// Get the axes that reverse direction, ignoring those that take no steps
+uint8_t Backlash::get_changed_dir(const int32_t &da, const int32_t &db, const int32_t &dc, const uint8_t dm) {
+  uint8_t changed_dir = last_direction_bits ^ dm;
+  if (da == 0) CBI(changed_dir, X_AXIS);
+  if (db == 0) CBI(changed_dir, Y_AXIS);
+  if (dc == 0) CBI(changed_dir, Z_AXIS);
+  last_direction_bits ^= changed_dir;
+  return changed_dir;
+}
+
 /**
  * To minimize seams in the printed part, backlash correction only adds
  * steps to the current segment (instead of creating a new segment, which
@@ -61,13 +77,21 @@ Backlash backlash;
  */
 
 void Backlash::add_correction_steps(const int32_t &da, const int32_t &db, const int32_t &dc, const uint8_t dm, block_t * const block) {
-  static uint8_t last_direction_bits;
-  uint8_t changed_dir = last_direction_bits ^ dm;
-  // Ignore direction change if no steps are taken in that direction
-  if (da == 0) CBI(changed_dir, X_AXIS);
-  if (db == 0) CBI(changed_dir, Y_AXIS);
-  if (dc == 0) CBI(changed_dir, Z_AXIS);
-  last_direction_bits ^= changed_dir;
+  #if ENABLED(BACKLASH_TAKEUP_MOVE)
+
+    // Reversals were already taken up by get_takeup_steps. Add any take-up
+    // that was too short for a block of its own, if this block goes its way.
+    UNUSED(da); UNUSED(db); UNUSED(dc);
+    LOOP_XYZ(axis) {
+      if (pending[axis] && block->steps[axis] && TEST(dm, axis) == (pending[axis] < 0)) {
+        block->steps[axis] += ABS(pending[axis]);
+        pending[axis] = 0;
+      }
+    }
+
+  #else
+
+  const uint8_t changed_dir = get_changed_dir(da, db, dc, dm);
 
   if (correction == 0) return;
 
@@ -120,8 +144,48 @@ void Backlash::add_correction_steps(const int32_t &da, const int32_t &db, const
       }
     }
   }
+
+  #endif // !BACKLASH_TAKEUP_MOVE
 }
 
+#if ENABLED(BACKLASH_TAKEUP_MOVE)
+
+  /**
+   * With BACKLASH_TAKEUP_MOVE the planner queues the take-up as a short block
+   * of its own ahead of a move that reverses an axis. Being planned like any
+   * other block, it gets proper junction speeds on both sides, and the move
+   * that follows keeps its own speed and length.
+   *
+   * Return true with the take-up steps for a move that needs a take-up block.
+   * A take-up too short to make a block is added to the move itself instead.
+   */
+  bool Backlash::get_takeup_steps(const int32_t &da, const int32_t &db, const int32_t &dc, xyz_long_t &takeup) {
+    uint8_t dm = 0;
+    if (da < 0) SBI(dm, X_AXIS);
+    if (db < 0) SBI(dm, Y_AXIS);
+    if (dc < 0) SBI(dm, Z_AXIS);
+
+    const uint8_t changed_dir = get_changed_dir(da, db, dc, dm);
+    if (!changed_dir || correction == 0) return false;
+
+    const float f_corr = float(correction) / 255.0f;
+    int32_t most = 0;
+    LOOP_XYZ(axis) {
+      takeup[axis] = 0;
+      if (distance_mm[axis] && TEST(changed_dir, axis)) {
+        takeup[axis] = (TEST(dm, axis) ? -f_corr : f_corr) * distance_mm[axis] * planner.settings.axis_steps_per_mm[axis];
+        NOLESS(most, ABS(takeup[axis]));
+      }
+    }
+
+    if (most >= MIN_STEPS_PER_SEGMENT) return true;
+
+    pending += takeup;
+    return false;
+  }
+
+#endif // BACKLASH_TAKEUP_MOVE
+
 #if ENABLED(MEASURE_BACKLASH_WHEN_PROBING)
   #if HAS_CUSTOM_PROBE_PIN
     #define TEST_PROBE_PIN (READ(Z_MIN_PROBE_PIN) != Z_MIN_PROBE_ENDSTOP_INVERTING)
@@ -72,6 +72,17 @@ public:
   }
 
   void add_correction_steps(const int32_t &da, const int32_t &db, const int32_t &dc, const uint8_t dm, block_t * const block);
+
+  #if ENABLED(BACKLASH_TAKEUP_MOVE)
+    static bool get_takeup_steps(const int32_t &da, const int32_t &db, const int32_t &dc, xyz_long_t &takeup);
+  #endif
+
+private:
+  static uint8_t last_direction_bits;
+  static uint8_t get_changed_dir(const int32_t &da, const int32_t &db, const int32_t &dc, const uint8_t dm);
+  #if ENABLED(BACKLASH_TAKEUP_MOVE)
+    static xyz_long_t pending;
+  #endif
 };
 
 extern Backlash backlash;
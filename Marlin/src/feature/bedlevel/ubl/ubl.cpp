@@ -66,6 +66,11 @@
 
   int8_t unified_bed_leveling::storage_slot;
 
+  #if ENABLED(UBL_PRINT_AREA_PROBING)
+    bool unified_bed_leveling::print_area_known; // = false
+    xy_pos_t unified_bed_leveling::print_area_min, unified_bed_leveling::print_area_max;
+  #endif
+
   float unified_bed_leveling::z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
   #define _GRIDPOS(A,N) (MESH_MIN_##A + N * (MESH_##A##_DIST))
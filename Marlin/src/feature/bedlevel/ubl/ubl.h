@@ -70,6 +70,13 @@ class unified_bed_leveling {
     static bool g29_parameter_parsing() _O0;
     static void shift_mesh_height();
     static void probe_entire_mesh(const xy_pos_t &near, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest) _O0;
+    #if ENABLED(UBL_ADAPTIVE_PROBING)
+      static bool probe_unmarked_points(MeshFlags &done, const xy_pos_t &near, const bool do_ubl_mesh_map, const bool stow_probe);
+      static void probe_adaptive_mesh(const xy_pos_t &near, const bool do_ubl_mesh_map, const bool stow_probe, const float &threshold) _O0;
+    #endif
+    #if ENABLED(UBL_PRINT_AREA_PROBING)
+      static bool invalidate_print_area();
+    #endif
     static void tilt_mesh_based_on_3pts(const float &z1, const float &z2, const float &z3);
     static void tilt_mesh_based_on_probed_grid(const bool do_ubl_mesh_map);
     static bool smart_fill_one(const uint8_t x, const uint8_t y, const int8_t xdir, const int8_t ydir);
@@ -105,6 +112,18 @@ class unified_bed_leveling {
 
     static int8_t storage_slot;
 
+    #if ENABLED(UBL_PRINT_AREA_PROBING)
+      // XY extents of the current SD job, from its header
+      static bool print_area_known;
+      static xy_pos_t print_area_min, print_area_max;
+      static inline void set_print_area(const xy_pos_t &amin, const xy_pos_t &amax) {
+        print_area_min = amin;
+        print_area_max = amax;
+        print_area_known = true;
+      }
+      static inline void clear_print_area() { print_area_known = false; }
+    #endif
+
     static bed_mesh_t z_values;
     static const float _mesh_index_to_xpos[GRID_MAX_POINTS_X],
                        _mesh_index_to_ypos[GRID_MAX_POINTS_Y];
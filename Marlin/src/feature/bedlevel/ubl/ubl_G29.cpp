@@ -165,6 +165,15 @@
    *
    *                    Use 'T' (Topology) to generate a report of mesh generation.
    *
+   *                    With UBL_ADAPTIVE_PROBING, 'O' probes a coarse grid first, then probes the points in
+   *                    between only where a plane fit of the surrounding coarse points leaves a residual greater
+   *                    than UBL_ADAPTIVE_THRESHOLD (or the given 'O' value). The other points are filled from the fit.
+   *
+   *                    With UBL_PRINT_AREA_PROBING, 'N' reloads the active mesh slot and re-probes only the points
+   *                    under the current SD job's extents (plus UBL_PRINT_AREA_MARGIN), keeping the rest of the stored
+   *                    mesh. The extents come from ;MINX: ;MINY: ;MAXX: ;MAXY: lines in the file header, as written
+   *                    by Cura or a slicer start G-code template. Without them the whole mesh is probed.
+   *
    *                    P1 will suspend Mesh generation if the controller button is held down. Note that you may need
    *                    to press and hold the switch for several seconds if moves are underway.
    *
@@ -437,6 +446,15 @@
             //
             // Invalidate Entire Mesh and Automatically Probe Mesh in areas that can be reached by the probe
             //
+            #if ENABLED(UBL_PRINT_AREA_PROBING)
+              if (parser.seen('N')) {
+                if (!invalidate_print_area()) {
+                  invalidate();
+                  SERIAL_ECHOLNPGM("Mesh invalidated. Probing mesh.");
+                }
+              }
+              else
+            #endif
             if (!parser.seen('C')) {
               invalidate();
               SERIAL_ECHOLNPGM("Mesh invalidated. Probing mesh.");
@@ -448,7 +466,14 @@
               SERIAL_ECHOLNPGM(").\n");
             }
             const xy_pos_t near_probe_xy = g29_pos + probe.offset_xy;
-            probe_entire_mesh(near_probe_xy, parser.seen('T'), parser.seen('E'), parser.seen('U'));
+            #if ENABLED(UBL_ADAPTIVE_PROBING)
+              if (parser.seen('O')) {
+                const float threshold = parser.has_value() ? parser.value_linear_units() : float(UBL_ADAPTIVE_THRESHOLD);
+                probe_adaptive_mesh(near_probe_xy, parser.seen('T'), parser.seen('E'), threshold);
+              }
+              else
+            #endif
+                probe_entire_mesh(near_probe_xy, parser.seen('T'), parser.seen('E'), parser.seen('U'));
 
             report_current_position();
             probe_deployed = true;
@@ -790,6 +815,188 @@
       );
     }
 
+    #if ENABLED(UBL_PRINT_AREA_PROBING)
+
+      /**
+       * Reload the active mesh slot and invalidate the points needed to cover
+       * the print area, so G29 P1 merges fresh probes into the stored mesh.
+       * Points that are invalid in storage get probed too.
+       * Return false if there's no print area or stored mesh to merge into.
+       */
+      bool unified_bed_leveling::invalidate_print_area() {
+        if (!print_area_known) {
+          SERIAL_ECHOLNPGM("No print area.");
+          return false;
+        }
+
+        if (storage_slot < 0 || !settings.load_mesh(storage_slot)) {
+          SERIAL_ECHOLNPGM("No stored mesh for the print area.");
+          return false;
+        }
+
+        set_bed_leveling_enabled(false);
+
+        // Every cell the area touches needs all four of its corners
+        const xy_int8_t smin = cell_indexes(print_area_min.x - (UBL_PRINT_AREA_MARGIN), print_area_min.y - (UBL_PRINT_AREA_MARGIN)),
+                        smax = cell_indexes(print_area_max.x + (UBL_PRINT_AREA_MARGIN), print_area_max.y + (UBL_PRINT_AREA_MARGIN));
+        const uint8_t ex = _MIN(smax.x + 1, (GRID_MAX_POINTS_X) - 1),
+                      ey = _MIN(smax.y + 1, (GRID_MAX_POINTS_Y) - 1);
+
+        for (uint8_t x = smin.x; x <= ex; x++)
+          for (uint8_t y = smin.y; y <= ey; y++) {
+            z_values[x][y] = NAN;
+            TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, NAN));
+          }
+
+        SERIAL_ECHOLNPAIR("Probing print area X", print_area_min.x, ":", print_area_max.x, " Y", print_area_min.y, ":", print_area_max.y);
+        return true;
+      }
+
+    #endif // UBL_PRINT_AREA_PROBING
+
+    #if ENABLED(UBL_ADAPTIVE_PROBING)
+
+      /**
+       * Probe the reachable mesh points not marked in 'done', closest first.
+       * Return false if the user aborted with the controller button.
+       */
+      bool unified_bed_leveling::probe_unmarked_points(MeshFlags &done, const xy_pos_t &near, const bool do_ubl_mesh_map, const bool stow_probe) {
+        int total = 0, point_num = 0;
+        GRID_LOOP(x, y) if (!done.marked(x, y)) total++;
+
+        for (;;) {
+          if (do_ubl_mesh_map) display_map(g29_map_type);
+
+          #if HAS_LCD_MENU
+            if (ui.button_pressed()) {
+              ui.quick_feedback(false); // Preserve button state for click-and-hold
+              SERIAL_ECHOLNPGM("\nMesh only partially populated.\n");
+              ui.wait_for_release();
+              ui.quick_feedback();
+              ui.release();
+              return false;
+            }
+          #endif
+
+          const mesh_index_pair best = find_closest_mesh_point_of_type(SET_IN_BITMAP, near, true, &done);
+          if (best.pos.x < 0) break; // No more reachable points
+
+          done.mark(best.pos);
+          point_num++;
+          SERIAL_ECHOLNPAIR("\nProbing mesh point ", point_num, "/", total, ".\n");
+          TERN_(HAS_DISPLAY, ui.status_printf_P(0, PSTR(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_MESH), point_num, total));
+
+          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::PROBE_START));
+          const float measured_z = probe.probe_at_point(
+                        best.meshpos(),
+                        stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE, g29_verbose_level
+                      );
+          z_values[best.pos.x][best.pos.y] = measured_z;
+          #if ENABLED(EXTENSIBLE_UI)
+            ExtUI::onMeshUpdate(best.pos, ExtUI::PROBE_FINISH);
+            ExtUI::onMeshUpdate(best.pos, measured_z);
+          #endif
+          SERIAL_FLUSH(); // Prevent host M105 buffer overrun.
+        }
+        return true;
+      }
+
+      /**
+       * Fit a plane to the valid mesh points within two coarse cells of the given point.
+       * This window always holds coarse points on both sides, so a bowl or ridge that
+       * a single cell's corners can't see still shows up in the residual.
+       * Return the largest residual of the fit, or NAN if there's too little data.
+       */
+      static float adaptive_plane_fit(const uint8_t ix, const uint8_t iy, linear_fit_data &lsf) {
+        constexpr int8_t R = 2 * (UBL_ADAPTIVE_STRIDE) - 1;
+        const uint8_t sx = _MAX(int(ix) - R, 0), ex = _MIN(ix + R, (GRID_MAX_POINTS_X) - 1),
+                      sy = _MAX(int(iy) - R, 0), ey = _MIN(iy + R, (GRID_MAX_POINTS_Y) - 1);
+
+        incremental_LSF_reset(&lsf);
+        for (uint8_t x = sx; x <= ex; x++)
+          for (uint8_t y = sy; y <= ey; y++) {
+            const float z = ubl.z_values[x][y];
+            if (!isnan(z)) incremental_LSF(&lsf, ubl.mesh_index_to_xpos(x), ubl.mesh_index_to_ypos(y), z);
+          }
+
+        // Three points always fit exactly, so a fourth is needed to judge flatness
+        if (lsf.N < 4 || finish_incremental_LSF(&lsf)) return NAN;
+
+        float worst = 0;
+        for (uint8_t x = sx; x <= ex; x++)
+          for (uint8_t y = sy; y <= ey; y++) {
+            const float z = ubl.z_values[x][y];
+            if (!isnan(z)) NOLESS(worst, ABS(z + lsf.D + lsf.A * ubl.mesh_index_to_xpos(x) + lsf.B * ubl.mesh_index_to_ypos(y)));
+          }
+        return worst;
+      }
+
+      /**
+       * Probe every UBL_ADAPTIVE_STRIDE'th mesh point (plus the last row and column),
+       * then probe the points in between only where the surrounding coarse points
+       * don't lie on a plane within 'threshold'. Fill the remaining points from the
+       * local plane so the result is a complete UBL mesh.
+       */
+      void unified_bed_leveling::probe_adaptive_mesh(const xy_pos_t &near, const bool do_ubl_mesh_map, const bool stow_probe, const float &threshold) {
+        probe.deploy(); // Deploy before ui.capture() to allow for PAUSE_BEFORE_DEPLOY_STOW
+
+        TERN_(HAS_LCD_MENU, ui.capture());
+
+        save_ubl_active_state_and_disable();  // No bed level correction so only raw data is obtained
+
+        #define IS_COARSE(I,N) ((I) % (UBL_ADAPTIVE_STRIDE) == 0 || (I) == (N) - 1)
+
+        // Pass 1: the coarse grid. Points that are already valid (G29 P1 O C) are kept.
+        MeshFlags done;
+        done.fill();
+        GRID_LOOP(x, y)
+          if (isnan(z_values[x][y]) && IS_COARSE(x, GRID_MAX_POINTS_X) && IS_COARSE(y, GRID_MAX_POINTS_Y))
+            done.unmark(x, y);
+
+        bool completed = probe_unmarked_points(done, near, do_ubl_mesh_map, stow_probe);
+
+        // Pass 2: refine wherever the coarse points around a missing point aren't flat
+        linear_fit_data lsf;
+        if (completed) {
+          done.fill();
+          uint8_t refine_count = 0;
+          GRID_LOOP(x, y) if (isnan(z_values[x][y])) {
+            const float resid = adaptive_plane_fit(x, y, lsf);
+            if (isnan(resid) || resid > threshold) { done.unmark(x, y); refine_count++; }
+          }
+          if (g29_verbose_level > 0) SERIAL_ECHOLNPAIR("Refining ", int(refine_count), " mesh points.");
+          completed = probe_unmarked_points(done, near, do_ubl_mesh_map, stow_probe);
+        }
+
+        // Fill what's left from the local plane. Points without enough data stay invalid for P2 / P3.
+        if (completed) {
+          GRID_LOOP(x, y) if (isnan(z_values[x][y]) && !isnan(adaptive_plane_fit(x, y, lsf))) {
+            z_values[x][y] = -lsf.D - lsf.A * mesh_index_to_xpos(x) - lsf.B * mesh_index_to_ypos(y);
+            TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+          }
+        }
+
+        // Release UI during stow to allow for PAUSE_BEFORE_DEPLOY_STOW
+        TERN_(HAS_LCD_MENU, ui.release());
+        probe.stow();
+        TERN_(HAS_LCD_MENU, ui.capture());
+
+        if (!completed) return restore_ubl_active_state_and_leave();
+
+        probe.move_z_after_probing();
+
+        restore_ubl_active_state_and_leave();
+
+        do_blocking_move_to_xy(
+          constrain(near.x - probe.offset_xy.x, MESH_MIN_X, MESH_MAX_X),
+          constrain(near.y - probe.offset_xy.y, MESH_MIN_Y, MESH_MAX_Y)
+        );
+
+        #undef IS_COARSE
+      }
+
+    #endif // UBL_ADAPTIVE_PROBING
+
   #endif // HAS_BED_PROBE
 
   #if HAS_LCD_MENU
@@ -138,6 +138,45 @@ void FWRetract::retract(const bool retracting
   #endif
 
   const feedRate_t fr_max_z = planner.settings.max_feedrate_mm_s[Z_AXIS];
+
+  #if ENABLED(FWRETRACT_COMBINED_HOP)
+
+    /**
+     * Do the E move and the Z hop together in one block, E at its set
+     * feedrate and Z over the same time, leaving the planner one corner
+     * to slow down for instead of two.
+     */
+    const float hop = retracting
+      ? (!current_hop && settings.retract_zraise > 0.01f ? settings.retract_zraise : 0)  // Apply hop only once
+      : current_hop;
+
+    float e_length = base_retract;
+    feedRate_t fr_e = settings.retract_feedrate_mm_s;
+
+    if (retracting)
+      current_retract[active_extruder] = base_retract;
+    else {
+      const float extra_recover = swapping ? settings.swap_retract_recover_extra : settings.retract_recover_extra;
+      if (extra_recover) {
+        current_position.e -= extra_recover;        // Adjust the current E position by the extra amount to recover
+        sync_plan_position_e();                     // Sync the planner position so the extra amount is recovered
+        e_length += extra_recover;
+      }
+      fr_e = swapping ? settings.swap_retract_recover_feedrate_mm_s : settings.retract_recover_feedrate_mm_s;
+      current_retract[active_extruder] = 0;
+    }
+    fr_e *= TERN1(RETRACT_SYNC_MIXING, (MIXING_STEPPERS));
+
+    if (hop) {
+      current_hop = retracting ? hop : 0;           // Raise or lower along with the E move
+      // Block feedrate applies to Z. Scale it so E moves at its own feedrate.
+      prepare_internal_move_to_destination(e_length > 0 ? _MIN(fr_max_z, fr_e * hop / e_length) : fr_max_z);
+    }
+    else
+      prepare_internal_move_to_destination(fr_e);
+
+  #else // !FWRETRACT_COMBINED_HOP
+
   if (retracting) {
     // Retract by moving from a faux E position back to the current E position
     current_retract[active_extruder] = base_retract;
@@ -175,6 +214,8 @@ void FWRetract::retract(const bool retracting
     );
   }
 
+  #endif // !FWRETRACT_COMBINED_HOP
+
   TERN_(RETRACT_SYNC_MIXING, mixer.T(old_mixing_tool));   // Restore original mixing tool
 
   retracted[active_extruder] = retracting;                // Active extruder now retracted / recovered
@@ -0,0 +1,240 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/joblog.cpp - Per-job statistics log on the SD card
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PRINTCOUNTER_JOB_LOG)
+
+#include "joblog.h"
+
+#include "../sd/cardreader.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+#include "../libs/duration_t.h"
+
+JobLog job_log;
+
+float JobLog::filament_base; // = 0
+uint32_t JobLog::samples,    // = 0
+         JobLog::hotend_sum,
+         JobLog::bed_sum,
+         JobLog::motion_samples;
+
+#define JOB_LOG_MARK   0xA5   // Starts every record
+#define JOB_LOG_FIELDS 5
+
+// Soft PWM full scale, as reported by getHeaterPower()
+#define HEATER_POWER_MAX 127
+
+static void record_to_fields(const job_record_t &r, int32_t f[JOB_LOG_FIELDS]) {
+  f[0] = r.duration; f[1] = r.filament; f[2] = r.hotend; f[3] = r.bed; f[4] = r.motion;
+}
+
+static void fields_to_record(const int32_t f[JOB_LOG_FIELDS], job_record_t &r) {
+  r.duration = f[0]; r.filament = f[1]; r.hotend = f[2]; r.bed = f[3]; r.motion = f[4];
+}
+
+/**
+ * Reset the accumulators at the start of a new job
+ */
+void JobLog::start(const float &filament_total) {
+  filament_base = filament_total;
+  samples = hotend_sum = bed_sum = motion_samples = 0;
+}
+
+/**
+ * Called once per second while the job is running
+ */
+void JobLog::sample() {
+  samples++;
+  hotend_sum += thermalManager.getHeaterPower(heater_ind_t(H_E0 + TERN0(HAS_MULTI_HOTEND, active_extruder)));
+  TERN_(HAS_HEATED_BED, bed_sum += thermalManager.getHeaterPower(H_BED));
+  if (planner.has_blocks_queued()) motion_samples++;
+}
+
+/**
+ * Read the log from the start, calling 'each' for every record.
+ * Stop at the end of the file or at the first damaged record.
+ * 'last' is left holding the last good record (zeroed if none)
+ * and 'good_size' the length of the file up to the end of it.
+ */
+bool JobLog::scan(job_record_t &last, void (*each)(const job_record_t&), uint32_t * const good_size/*=nullptr*/) {
+  last = { 0, 0, 0, 0, 0 };
+  if (good_size) *good_size = 0;
+
+  SdFile root = card.getroot(), file;
+  if (!file.open(&root, JOB_LOG_FILENAME, O_READ)) return false;
+
+  int32_t field[JOB_LOG_FIELDS] = { 0 };
+  while (file.read() == JOB_LOG_MARK) {
+    bool ok = true;
+    LOOP_L_N(i, JOB_LOG_FIELDS) {
+      uint32_t z = 0;
+      uint8_t shift = 0;
+      int16_t b;
+      do {
+        b = file.read();
+        if (b < 0 || shift > 28) { ok = false; break; }
+        z |= uint32_t(b & 0x7F) << shift;
+        shift += 7;
+      } while (b & 0x80);
+      if (!ok) break;
+      field[i] += int32_t(z >> 1) ^ -int32_t(z & 1); // Un-zigzag the delta
+    }
+    if (!ok) break;
+    fields_to_record(field, last);
+    if (each) (*each)(last);
+    if (good_size) *good_size = file.curPosition();
+  }
+
+  file.close();
+  return true;
+}
+
+/**
+ * Append a record for the job that just ended
+ */
+void JobLog::finish(const uint32_t duration, const float &filament_total) {
+  if (!card.isMounted() || !samples) return;
+
+  const uint32_t full_scale = samples * (HEATER_POWER_MAX);
+  const job_record_t rec = {
+    duration,
+    uint32_t(_MAX(0L, LROUND(filament_total - filament_base))),
+    uint8_t(uint64_t(hotend_sum) * 100 / full_scale),
+    uint8_t(uint64_t(bed_sum) * 100 / full_scale),
+    uint8_t(motion_samples * 100 / samples)
+  };
+
+  job_record_t last;
+  uint32_t good_size;
+  scan(last, nullptr, &good_size);
+
+  int32_t now[JOB_LOG_FIELDS], prev[JOB_LOG_FIELDS];
+  record_to_fields(rec, now);
+  record_to_fields(last, prev);
+
+  // One mark byte, then up to 5 varint bytes per field
+  uint8_t buf[1 + JOB_LOG_FIELDS * 5], len = 0;
+  buf[len++] = JOB_LOG_MARK;
+  LOOP_L_N(i, JOB_LOG_FIELDS) {
+    const int32_t d = now[i] - prev[i];
+    uint32_t z = (uint32_t(d) << 1) ^ uint32_t(d >> 31); // Zigzag so small negatives stay short
+    do {
+      const uint8_t b = z & 0x7F;
+      z >>= 7;
+      buf[len++] = z ? b | 0x80 : b;
+    } while (z);
+  }
+
+  SdFile root = card.getroot(), file;
+  if (!file.open(&root, JOB_LOG_FILENAME, O_CREAT | O_WRITE | O_APPEND)) {
+    SERIAL_ECHOLNPAIR(STR_SD_OPEN_FILE_FAIL, JOB_LOG_FILENAME, ".");
+    return;
+  }
+  // Drop a torn record (e.g., from a power loss) so the new one follows the last good one
+  if (file.fileSize() > good_size) file.truncate(good_size);
+  file.write(buf, len);
+  file.close();
+}
+
+/**
+ * Histogram buckets. Each count is for jobs below the edge,
+ * with a final bucket for everything beyond the last edge.
+ */
+static const uint16_t time_edge[] PROGMEM = { 15, 30, 60, 120, 240, 480, 960 }, // (min)
+                      fila_edge[] PROGMEM = { 1, 2, 5, 10, 20, 50, 100 };       // (m)
+
+static struct {
+  uint16_t jobs, time_count[COUNT(time_edge) + 1], fila_count[COUNT(fila_edge) + 1];
+  uint32_t time, filament, hotend, bed, motion;
+} rollup;
+
+static uint8_t bucket(const uint16_t edges[], const uint8_t n, const uint32_t v) {
+  uint8_t b = 0;
+  while (b < n && v >= pgm_read_word(&edges[b])) b++;
+  return b;
+}
+
+static void add_to_rollup(const job_record_t &r) {
+  rollup.jobs++;
+  rollup.time += r.duration;
+  rollup.filament += r.filament;
+  rollup.hotend += r.hotend;
+  rollup.bed += r.bed;
+  rollup.motion += r.motion;
+  rollup.time_count[bucket(time_edge, COUNT(time_edge), r.duration / 60)]++;
+  rollup.fila_count[bucket(fila_edge, COUNT(fila_edge), r.filament / 1000)]++;
+}
+
+static void print_histogram(PGM_P const label, const uint16_t edges[], const uint16_t counts[], const uint8_t n, PGM_P const unit) {
+  SERIAL_ECHOPGM(STR_STATS);
+  serialprintPGM(label);
+  LOOP_L_N(i, n) {
+    SERIAL_ECHOPAIR(" <", pgm_read_word(&edges[i]));
+    serialprintPGM(unit);
+    SERIAL_CHAR(':');
+    SERIAL_ECHO(counts[i]);
+  }
+  SERIAL_ECHOPAIR(" ", pgm_read_word(&edges[n - 1]));
+  serialprintPGM(unit);
+  SERIAL_ECHOPGM("+:");
+  SERIAL_ECHOLN(counts[n]);
+}
+
+/**
+ * Serial output of the rolled-up job log
+ */
+void JobLog::report() {
+  memset(&rollup, 0, sizeof(rollup));
+  job_record_t last;
+  if (!card.isMounted() || !scan(last, add_to_rollup)) {
+    SERIAL_ECHOLNPAIR(STR_SD_OPEN_FILE_FAIL, JOB_LOG_FILENAME, ".");
+    return;
+  }
+
+  char buffer[21];
+  duration_t(rollup.time).toString(buffer);
+  SERIAL_ECHOPGM(STR_STATS);
+  SERIAL_ECHOPAIR("Logged jobs: ", rollup.jobs, ", Time: ", buffer, ", Filament: ", rollup.filament / 1000);
+  SERIAL_CHAR('m');
+  SERIAL_EOL();
+
+  if (rollup.jobs) {
+    SERIAL_ECHOPGM(STR_STATS);
+    SERIAL_ECHOLNPAIR(
+      "Avg duty hotend: ", rollup.hotend / rollup.jobs,
+      "% bed: ", rollup.bed / rollup.jobs,
+      "% motion: ", rollup.motion / rollup.jobs, "%"
+    );
+  }
+
+  print_histogram(PSTR("Job time"), time_edge, rollup.time_count, COUNT(time_edge), PSTR("min"));
+  print_histogram(PSTR("Filament"), fila_edge, rollup.fila_count, COUNT(fila_edge), PSTR("m"));
+}
+
+#endif // PRINTCOUNTER_JOB_LOG
@@ -0,0 +1,59 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/joblog.h - Per-job statistics log on the SD card
+ *
+ * Each finished job appends one record to JOB_LOG_FILENAME. Records are
+ * stored as zigzag varint deltas from the previous record, so a typical
+ * job costs only a handful of bytes. 'M78 H' rolls the log up into
+ * histograms of job time and filament use.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define JOB_LOG_FILENAME "JOBLOG.BIN"
+
+typedef struct {
+  uint32_t duration;  // (s) Job time
+  uint32_t filament;  // (mm) Filament used by the job
+  uint8_t hotend,     // (%) Average hotend heater duty
+          bed,        // (%) Average bed heater duty
+          motion;     // (%) Share of the job with moves in the planner
+} job_record_t;
+
+class JobLog {
+public:
+  static void start(const float &filament_total);
+  static void sample();
+  static void finish(const uint32_t duration, const float &filament_total);
+  static void report();
+
+private:
+  static float filament_base;
+  static uint32_t samples, hotend_sum, bed_sum, motion_samples;
+
+  static bool scan(job_record_t &last, void (*each)(const job_record_t&), uint32_t * const good_size=nullptr);
+};
+
+extern JobLog job_log;
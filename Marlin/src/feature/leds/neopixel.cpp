@@ -37,6 +37,16 @@
 Marlin_NeoPixel neo;
 int8_t Marlin_NeoPixel::neoindex;
 
+#if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+  bool Marlin_NeoPixel::dirty; // = false
+  millis_t Marlin_NeoPixel::next_show_ms; // = 0
+  #if NEOPIXEL_FADE_TIME > 0
+    uint32_t Marlin_NeoPixel::shown_color, Marlin_NeoPixel::fade_from, Marlin_NeoPixel::fade_to;
+    millis_t Marlin_NeoPixel::fade_start_ms;
+    bool Marlin_NeoPixel::fading; // = false
+  #endif
+#endif
+
 Adafruit_NeoPixel Marlin_NeoPixel::adaneo1(NEOPIXEL_PIXELS, NEOPIXEL_PIN, NEOPIXEL_TYPE + NEO_KHZ800)
   #if EITHER(MULTIPLE_NEOPIXEL_TYPES, NEOPIXEL2_INSERIES)
     , Marlin_NeoPixel::adaneo2(NEOPIXEL_PIXELS, NEOPIXEL2_PIN, NEOPIXEL2_TYPE + NEO_KHZ800)
@@ -52,21 +62,40 @@ Adafruit_NeoPixel Marlin_NeoPixel::adaneo1(NEOPIXEL_PIXELS, NEOPIXEL_PIN, NEOPIX
 
 #endif
 
+// Set the whole strip to one color, except for the background LED
+void Marlin_NeoPixel::fill(const uint32_t color) {
+  for (uint16_t i = 0; i < pixels(); ++i) {
+    #ifdef NEOPIXEL_BKGD_LED_INDEX
+      if (i == NEOPIXEL_BKGD_LED_INDEX && color != 0x000000) {
+        set_color_background();
+        continue;
+      }
+    #endif
+    set_pixel_color(i, color);
+  }
+  #if ENABLED(NEOPIXEL_DEFERRED_SHOW) && NEOPIXEL_FADE_TIME > 0
+    shown_color = color;
+  #endif
+}
+
 void Marlin_NeoPixel::set_color(const uint32_t color) {
   if (get_neo_index() >= 0) {
     set_pixel_color(get_neo_index(), color);
     set_neo_index(-1);
   }
   else {
-    for (uint16_t i = 0; i < pixels(); ++i) {
-      #ifdef NEOPIXEL_BKGD_LED_INDEX
-        if (i == NEOPIXEL_BKGD_LED_INDEX && color != 0x000000) {
-          set_color_background();
-          continue;
-        }
-      #endif
-      set_pixel_color(i, color);
-    }
+    #if ENABLED(NEOPIXEL_DEFERRED_SHOW) && NEOPIXEL_FADE_TIME > 0
+      // Fade from the color now shown. update() fills in the steps.
+      if (color != (fading ? fade_to : shown_color)) {
+        fade_from = shown_color;
+        fade_to = color;
+        fade_start_ms = millis();
+        fading = true;
+      }
+      return;
+    #else
+      fill(color);
+    #endif
   }
   show();
 }
@@ -74,14 +103,70 @@ void Marlin_NeoPixel::set_color(const uint32_t color) {
 void Marlin_NeoPixel::set_color_startup(const uint32_t color) {
   for (uint16_t i = 0; i < pixels(); ++i)
     set_pixel_color(i, color);
-  show();
+  transmit();
 }
 
+#if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+
+  /**
+   * Called from idle() to send changes to the strip, no more often than
+   * NEOPIXEL_SHOW_INTERVAL. Callers can change colors as often as they
+   * like without a transfer each time.
+   */
+  void Marlin_NeoPixel::update() {
+    const millis_t ms = millis();
+    if (PENDING(ms, next_show_ms)) return;
+
+    #if NEOPIXEL_FADE_TIME > 0
+      if (fading) {
+        const millis_t t = ms - fade_start_ms;
+        if (t >= NEOPIXEL_FADE_TIME) {
+          fading = false;
+          fill(fade_to);
+        }
+        else {
+          // Blend each 8-bit channel of the packed color
+          const uint8_t f = t * 255 / (NEOPIXEL_FADE_TIME);
+          uint32_t c = 0;
+          for (uint8_t sh = 0; sh < 32; sh += 8) {
+            const int16_t a = (fade_from >> sh) & 0xFF, b = (fade_to >> sh) & 0xFF;
+            c |= uint32_t(uint8_t(a + int32_t(b - a) * f / 255)) << sh;
+          }
+          fill(c);
+        }
+        dirty = true;
+      }
+    #endif
+
+    if (dirty) {
+      dirty = false;
+      next_show_ms = ms + (NEOPIXEL_SHOW_INTERVAL);
+      transmit();
+    }
+  }
+
+  // Finish any fade and send the strip now, for when idle() won't be called
+  void Marlin_NeoPixel::flush() {
+    #if NEOPIXEL_FADE_TIME > 0
+      if (fading) {
+        fading = false;
+        fill(fade_to);
+        dirty = true;
+      }
+    #endif
+    if (dirty) {
+      dirty = false;
+      transmit();
+    }
+  }
+
+#endif // NEOPIXEL_DEFERRED_SHOW
+
 void Marlin_NeoPixel::init() {
   set_neo_index(-1);                   // -1 .. NEOPIXEL_PIXELS-1 range
   set_brightness(NEOPIXEL_BRIGHTNESS); //  0 .. 255 range
   begin();
-  show();  // initialize to all off
+  transmit();  // initialize to all off
 
   #if ENABLED(NEOPIXEL_STARTUP_TEST)
     set_color_startup(adaneo1.Color(255, 0, 0, 0));  // red
@@ -67,6 +67,18 @@ private:
   ;
   static int8_t neoindex;
 
+  #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+    static bool dirty;                    // The strip needs sending
+    static millis_t next_show_ms;
+    #if NEOPIXEL_FADE_TIME > 0
+      static uint32_t shown_color, fade_from, fade_to;
+      static millis_t fade_start_ms;
+      static bool fading;
+    #endif
+  #endif
+
+  static void fill(const uint32_t c);
+
 public:
   static void init();
   static void set_color_startup(const uint32_t c);
@@ -108,7 +120,8 @@ public:
     #endif
   }
 
-  static inline void show() {
+  // Send the pixels to the strip now. Interrupts are off for the transfer.
+  static inline void transmit() {
     adaneo1.show();
     #if PIN_EXISTS(NEOPIXEL2)
       #if EITHER(MULTIPLE_NEOPIXEL_TYPES, NEOPIXEL2_INSERIES)
@@ -121,6 +134,19 @@ public:
     #endif
   }
 
+  static inline void show() {
+    #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+      dirty = true;                       // Sent later by update()
+    #else
+      transmit();
+    #endif
+  }
+
+  #if ENABLED(NEOPIXEL_DEFERRED_SHOW)
+    static void update();
+    static void flush();
+  #endif
+
   #if 0
     bool set_led_color(const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t w, const uint8_t p);
   #endif
@@ -103,6 +103,12 @@ int16_t MMU2::version = -1, MMU2::buildnr = -1;
 millis_t MMU2::prev_request, MMU2::prev_P0_request;
 char MMU2::rx_buffer[MMU_RX_SIZE], MMU2::tx_buffer[MMU_TX_SIZE];
 
+#if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+  MMU2::ToolChangeState MMU2::tc_state; // = TC_IDLE
+  uint8_t MMU2::tc_index, MMU2::cmd_timeouts;
+  uint16_t MMU2::tc_prep_seq;
+#endif
+
 #if BOTH(HAS_LCD_MENU, MMU2_MENUS)
 
   struct E_Step {
@@ -353,11 +359,14 @@ void MMU2::mmu_loop() {
           cmd = last_cmd;
           last_cmd = MMU_CMD_NONE;
         }
+        TERN_(MMU2_ASYNC_TOOL_CHANGE, if (cmd_timeouts < 255) cmd_timeouts++);
         state = 1;
       }
       TERN_(PRUSA_MMU2_S_MODE, check_filament());
       break;
   }
+
+  TERN_(MMU2_ASYNC_TOOL_CHANGE, tool_change_step());
 }
 
 /**
@@ -678,24 +687,98 @@ static void mmu2_not_responding() {
 void MMU2::tool_change(const uint8_t index) {
   if (!enabled) return;
 
+  TERN_(MMU2_ASYNC_TOOL_CHANGE, finish_tool_change());
+
   set_runout_valid(false);
 
   if (index != extruder) {
-    DISABLE_AXIS_E0();
     ui.status_printf_P(0, GET_TEXT(MSG_MMU2_LOADING_FILAMENT), int(index + 1));
-    command(MMU_CMD_T0 + index);
-    manage_response(true, true);
+    #if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+      // mmu_loop() sends T once the moves queued so far are done
+      tc_index = index;
+      tc_prep_seq = planner.block_sequence;
+      tc_state = TC_WAIT_PREP;
+      return;
+    #else
+      DISABLE_AXIS_E0();
+      command(MMU_CMD_T0 + index);
+      manage_response(true, true);
+      command(MMU_CMD_C0);
+      extruder = index; //filament change is finished
+      active_extruder = 0;
+      ENABLE_AXIS_E0();
+      SERIAL_ECHO_START();
+      SERIAL_ECHOLNPAIR(STR_ACTIVE_EXTRUDER, int(extruder));
+      ui.reset_status();
+    #endif
+  }
+
+  set_runout_valid(true);
+}
+
+#if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+
+  /**
+   * True once every block queued ahead of the T command has been executed.
+   * Blocks added later (travel moves) are not waited on.
+   */
+  bool MMU2::prep_moves_done() { return planner.blocks_done_before(tc_prep_seq); }
+
+  /**
+   * Advance a pending tool change. Called from mmu_loop(), so it must never
+   * block or plan moves.
+   */
+  void MMU2::tool_change_step() {
+    switch (tc_state) {
+      case TC_WAIT_PREP:
+        if (prep_moves_done()) {
+          DISABLE_AXIS_E0();
+          command(MMU_CMD_T0 + tc_index);
+          cmd_timeouts = 0;
+          tc_state = TC_SELECT;
+        }
+        break;
+
+      case TC_SELECT:
+        if (ready && state == 1 && cmd == MMU_CMD_NONE) {
+          ready = false;
+          tool_change_loaded();
+        }
+        break;
+
+      default: break;
+    }
+  }
+
+  void MMU2::tool_change_loaded() {
     command(MMU_CMD_C0);
-    extruder = index; //filament change is finished
+    extruder = tc_index; //filament change is finished
     active_extruder = 0;
     ENABLE_AXIS_E0();
     SERIAL_ECHO_START();
     SERIAL_ECHOLNPAIR(STR_ACTIVE_EXTRUDER, int(extruder));
     ui.reset_status();
+    set_runout_valid(true);
+    tc_state = TC_IDLE;
   }
 
-  set_runout_valid(true);
-}
+  /**
+   * Wait for a pending tool change. If the MMU has stopped answering, fall
+   * back to the blocking handler to park the head and wait for the user.
+   */
+  void MMU2::finish_tool_change() {
+    while (tc_state != TC_IDLE) {
+      if (tc_state == TC_SELECT && cmd_timeouts) {
+        tc_state = TC_RECOVER;
+        manage_response(true, true);
+        tool_change_loaded();
+        break;
+      }
+      idle();
+    }
+  }
+
+#endif // MMU2_ASYNC_TOOL_CHANGE
 
 /**
  *
@@ -1040,11 +1123,13 @@ void MMU2::filament_runout() {
 
       current_position.e += es;
       line_to_current_position(MMM_TO_MMS(fr_mm_m));
-      planner.synchronize();
 
       step++;
     }
 
+    // Queue the whole sequence so it runs as one blended move
+    planner.synchronize();
+
     DISABLE_AXIS_E0();
   }
 
@@ -49,6 +49,11 @@ public:
   static uint8_t get_current_tool();
   static void set_filament_type(const uint8_t index, const uint8_t type);
 
+  #if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+    static inline bool tool_change_pending() { return tc_state != TC_IDLE; }
+    static void finish_tool_change();
+  #endif
+
   #if BOTH(HAS_LCD_MENU, MMU2_MENUS)
     static bool unload();
     static void load_filament(uint8_t);
@@ -93,6 +98,21 @@ private:
     static void mmu_continue_loading();
   #endif
 
+  #if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+    enum ToolChangeState : uint8_t {
+      TC_IDLE,      // No change in progress
+      TC_WAIT_PREP, // Waiting for moves queued ahead of the T command
+      TC_SELECT,    // T sent, waiting for the MMU to answer
+      TC_RECOVER    // Timed out, the blocking handler owns the response
+    };
+    static ToolChangeState tc_state;
+    static uint8_t tc_index, cmd_timeouts;
+    static uint16_t tc_prep_seq;    // Planner sequence number of the first block after the T command
+    static bool prep_moves_done();
+    static void tool_change_step();
+    static void tool_change_loaded();
+  #endif
+
   static bool enabled, ready, mmu_print_saved;
 
   static uint8_t cmd, cmd_arg, last_cmd, extruder;
@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_TRACE)
+
+#include "stepper_trace.h"
+#include "../libs/hex_print.h"
+#include "../MarlinCore.h"
+
+StepperTrace stepper_trace;
+
+volatile bool StepperTrace::active; // = false
+trace_record_t StepperTrace::buffer[STEPPER_TRACE_SIZE];
+volatile uint16_t StepperTrace::head, StepperTrace::count;
+
+void StepperTrace::start() {
+  active = false;
+  head = count = 0;
+  active = true;
+}
+
+static void print_record(const trace_record_t &rec) {
+  const uint8_t * const b = (const uint8_t*)&rec;
+  LOOP_L_N(i, sizeof(trace_record_t)) print_hex_byte(b[i]);
+  SERIAL_EOL();
+}
+
+/**
+ * Print the buffer oldest-first, one record per line, framed by
+ * TRACE_BEGIN and TRACE_END. Tracing stops so the buffer holds still.
+ */
+void StepperTrace::dump() {
+  stop();
+
+  SERIAL_ECHOLNPGM("TRACE_BEGIN");
+  const trace_record_t header = { 1000000UL, TRACE_HEADER, TRACE_FORMAT_VERSION, uint16_t((STEPPER_TIMER_RATE) / 1000UL) };
+  print_record(header);
+  for (uint16_t n = count, i = (head - n) & (STEPPER_TRACE_SIZE - 1); n--; i = (i + 1) & (STEPPER_TRACE_SIZE - 1)) {
+    print_record(buffer[i]);
+    if (!(n & 0x1F)) idle(); // Keep the host and heaters serviced on long dumps
+  }
+  SERIAL_ECHOLNPGM("TRACE_END");
+
+  head = count = 0;
+}
+
+#endif // STEPPER_TRACE
@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/stepper_trace.h - Stepper ISR trace ring buffer
+ *
+ * Records stepper ISR entry and exit, block boundaries and temperature ISR
+ * entry and exit as 8-byte records (see core/trace.h) with microsecond
+ * timestamps. Logging is a few stores, so it is safe to call from ISRs.
+ * M936 dumps the buffer as hex for buildroot/share/scripts/stepper_trace.py.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../core/trace.h"
+
+class StepperTrace {
+public:
+  static volatile bool active;
+
+  static void start();
+  static void stop() { active = false; }
+  static void dump();
+
+  static inline void log(const TraceEvent event, const uint32_t value=0, const uint8_t flags=0) {
+    if (!active) return;
+    // ISRs may nest, so take the slot before filling it
+    CRITICAL_SECTION_START();
+      const uint16_t i = head;
+      head = (i + 1) & (STEPPER_TRACE_SIZE - 1);
+      if (count < STEPPER_TRACE_SIZE) count++;
+    CRITICAL_SECTION_END();
+    trace_record_t &rec = buffer[i];
+    rec.time = micros();
+    rec.event = event;
+    rec.flags = flags;
+    rec.value = trace_value(value);
+  }
+
+private:
+  static trace_record_t buffer[STEPPER_TRACE_SIZE];
+  static volatile uint16_t head, count;
+};
+
+extern StepperTrace stepper_trace;
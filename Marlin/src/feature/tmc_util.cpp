@@ -326,122 +326,199 @@
     return should_step_down;
   }
 
-  void monitor_tmc_drivers() {
-    const millis_t ms = millis();
-
-    // Poll TMC drivers at the configured interval
-    static millis_t next_poll = 0;
-    const bool need_update_error_counters = ELAPSED(ms, next_poll);
-    if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
-
-    // Also poll at intervals for debugging
-    #if ENABLED(TMC_DEBUG)
-      static millis_t next_debug_reporting = 0;
-      const bool need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
-      if (need_debug_reporting) next_debug_reporting = ms + report_tmc_status_interval;
-    #else
-      constexpr bool need_debug_reporting = false;
+  /**
+   * Drivers are polled one at a time, one register read per call from idle().
+   * On UART drivers each DRV_STATUS read blocks for several milliseconds, so
+   * a full pass is spread across successive main loop iterations instead of
+   * stalling the planner for the whole chain at once.
+   */
+  enum TMCPollDriver : uint8_t {
+    #if AXIS_IS_TMC(X)
+      POLL_X,
+    #endif
+    #if AXIS_IS_TMC(X2)
+      POLL_X2,
+    #endif
+    #if AXIS_IS_TMC(Y)
+      POLL_Y,
+    #endif
+    #if AXIS_IS_TMC(Y2)
+      POLL_Y2,
+    #endif
+    #if AXIS_IS_TMC(Z)
+      POLL_Z,
+    #endif
+    #if AXIS_IS_TMC(Z2)
+      POLL_Z2,
+    #endif
+    #if AXIS_IS_TMC(Z3)
+      POLL_Z3,
+    #endif
+    #if AXIS_IS_TMC(Z4)
+      POLL_Z4,
+    #endif
+    #if AXIS_IS_TMC(E0)
+      POLL_E0,
+    #endif
+    #if AXIS_IS_TMC(E1)
+      POLL_E1,
+    #endif
+    #if AXIS_IS_TMC(E2)
+      POLL_E2,
+    #endif
+    #if AXIS_IS_TMC(E3)
+      POLL_E3,
     #endif
+    #if AXIS_IS_TMC(E4)
+      POLL_E4,
+    #endif
+    #if AXIS_IS_TMC(E5)
+      POLL_E5,
+    #endif
+    #if AXIS_IS_TMC(E6)
+      POLL_E6,
+    #endif
+    #if AXIS_IS_TMC(E7)
+      POLL_E7,
+    #endif
+    POLL_DRIVER_COUNT
+  };
 
-    if (need_update_error_counters || need_debug_reporting) {
+  // Poll one driver and return the axis bit if its current should be stepped down
+  static uint8_t poll_tmc_driver(const uint8_t d, const bool need_update_error_counters, const bool need_debug_reporting) {
+    #define _POLL_AXIS(ST, A) case POLL_##ST: return monitor_tmc_driver(stepper##ST, need_update_error_counters, need_debug_reporting) ? _BV(A##_AXIS) : 0
+    #define _POLL_E(ST) case POLL_##ST: (void)monitor_tmc_driver(stepper##ST, need_update_error_counters, need_debug_reporting); break
+    switch (d) {
+      #if AXIS_IS_TMC(X)
+        _POLL_AXIS(X, X);
+      #endif
+      #if AXIS_IS_TMC(X2)
+        _POLL_AXIS(X2, X);
+      #endif
+      #if AXIS_IS_TMC(Y)
+        _POLL_AXIS(Y, Y);
+      #endif
+      #if AXIS_IS_TMC(Y2)
+        _POLL_AXIS(Y2, Y);
+      #endif
+      #if AXIS_IS_TMC(Z)
+        _POLL_AXIS(Z, Z);
+      #endif
+      #if AXIS_IS_TMC(Z2)
+        _POLL_AXIS(Z2, Z);
+      #endif
+      #if AXIS_IS_TMC(Z3)
+        _POLL_AXIS(Z3, Z);
+      #endif
+      #if AXIS_IS_TMC(Z4)
+        _POLL_AXIS(Z4, Z);
+      #endif
+      #if AXIS_IS_TMC(E0)
+        _POLL_E(E0);
+      #endif
+      #if AXIS_IS_TMC(E1)
+        _POLL_E(E1);
+      #endif
+      #if AXIS_IS_TMC(E2)
+        _POLL_E(E2);
+      #endif
+      #if AXIS_IS_TMC(E3)
+        _POLL_E(E3);
+      #endif
+      #if AXIS_IS_TMC(E4)
+        _POLL_E(E4);
+      #endif
+      #if AXIS_IS_TMC(E5)
+        _POLL_E(E5);
+      #endif
+      #if AXIS_IS_TMC(E6)
+        _POLL_E(E6);
+      #endif
+      #if AXIS_IS_TMC(E7)
+        _POLL_E(E7);
+      #endif
+      default: break;
+    }
+    #undef _POLL_AXIS
+    #undef _POLL_E
+    return 0;
+  }
 
-      #if AXIS_IS_TMC(X) || AXIS_IS_TMC(X2)
-      {
-        bool result = false;
+  // Step down all drivers of each axis flagged during the last pass
+  static void step_down_tmc_drivers(const uint8_t axes) {
+    UNUSED(axes);
+    #if AXIS_IS_TMC(X) || AXIS_IS_TMC(X2)
+      if (TEST(axes, X_AXIS)) {
         #if AXIS_IS_TMC(X)
-          if (monitor_tmc_driver(stepperX, need_update_error_counters, need_debug_reporting)) result = true;
+          step_current_down(stepperX);
         #endif
         #if AXIS_IS_TMC(X2)
-          if (monitor_tmc_driver(stepperX2, need_update_error_counters, need_debug_reporting)) result = true;
+          step_current_down(stepperX2);
         #endif
-        if (result) {
-          #if AXIS_IS_TMC(X)
-            step_current_down(stepperX);
-          #endif
-          #if AXIS_IS_TMC(X2)
-            step_current_down(stepperX2);
-          #endif
-        }
       }
-      #endif
-
-      #if AXIS_IS_TMC(Y) || AXIS_IS_TMC(Y2)
-      {
-        bool result = false;
+    #endif
+    #if AXIS_IS_TMC(Y) || AXIS_IS_TMC(Y2)
+      if (TEST(axes, Y_AXIS)) {
         #if AXIS_IS_TMC(Y)
-          if (monitor_tmc_driver(stepperY, need_update_error_counters, need_debug_reporting)) result = true;
+          step_current_down(stepperY);
         #endif
         #if AXIS_IS_TMC(Y2)
-          if (monitor_tmc_driver(stepperY2, need_update_error_counters, need_debug_reporting)) result = true;
+          step_current_down(stepperY2);
         #endif
-        if (result) {
-          #if AXIS_IS_TMC(Y)
-            step_current_down(stepperY);
-          #endif
-          #if AXIS_IS_TMC(Y2)
-            step_current_down(stepperY2);
-          #endif
-        }
       }
-      #endif
-
-      #if AXIS_IS_TMC(Z) || AXIS_IS_TMC(Z2) || AXIS_IS_TMC(Z3) || AXIS_IS_TMC(Z4)
-      {
-        bool result = false;
+    #endif
+    #if AXIS_IS_TMC(Z) || AXIS_IS_TMC(Z2) || AXIS_IS_TMC(Z3) || AXIS_IS_TMC(Z4)
+      if (TEST(axes, Z_AXIS)) {
         #if AXIS_IS_TMC(Z)
-          if (monitor_tmc_driver(stepperZ, need_update_error_counters, need_debug_reporting)) result = true;
+          step_current_down(stepperZ);
         #endif
         #if AXIS_IS_TMC(Z2)
-          if (monitor_tmc_driver(stepperZ2, need_update_error_counters, need_debug_reporting)) result = true;
+          step_current_down(stepperZ2);
         #endif
         #if AXIS_IS_TMC(Z3)
-          if (monitor_tmc_driver(stepperZ3, need_update_error_counters, need_debug_reporting)) result = true;
+          step_current_down(stepperZ3);
         #endif
         #if AXIS_IS_TMC(Z4)
-          if (monitor_tmc_driver(stepperZ4, need_update_error_counters, need_debug_reporting)) result = true;
+          step_current_down(stepperZ4);
         #endif
-        if (result) {
-          #if AXIS_IS_TMC(Z)
-            step_current_down(stepperZ);
-          #endif
-          #if AXIS_IS_TMC(Z2)
-            step_current_down(stepperZ2);
-          #endif
-          #if AXIS_IS_TMC(Z3)
-            step_current_down(stepperZ3);
-          #endif
-          #if AXIS_IS_TMC(Z4)
-            step_current_down(stepperZ4);
-          #endif
-        }
       }
-      #endif
+    #endif
+  }
 
-      #if AXIS_IS_TMC(E0)
-        (void)monitor_tmc_driver(stepperE0, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E1)
-        (void)monitor_tmc_driver(stepperE1, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E2)
-        (void)monitor_tmc_driver(stepperE2, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E3)
-        (void)monitor_tmc_driver(stepperE3, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E4)
-        (void)monitor_tmc_driver(stepperE4, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E5)
-        (void)monitor_tmc_driver(stepperE5, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E6)
-        (void)monitor_tmc_driver(stepperE6, need_update_error_counters, need_debug_reporting);
-      #endif
-      #if AXIS_IS_TMC(E7)
-        (void)monitor_tmc_driver(stepperE7, need_update_error_counters, need_debug_reporting);
+  void monitor_tmc_drivers() {
+    static uint8_t poll_index = POLL_DRIVER_COUNT,  // Next driver to poll, or POLL_DRIVER_COUNT between passes
+                   step_down_axes;                  // Axes flagged for current step-down during this pass
+    static bool need_update_error_counters, need_debug_reporting;
+
+    if (poll_index >= POLL_DRIVER_COUNT) {
+      const millis_t ms = millis();
+
+      // Poll TMC drivers at the configured interval
+      static millis_t next_poll = 0;
+      need_update_error_counters = ELAPSED(ms, next_poll);
+      if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
+
+      // Also poll at intervals for debugging
+      #if ENABLED(TMC_DEBUG)
+        static millis_t next_debug_reporting = 0;
+        need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
+        if (need_debug_reporting) next_debug_reporting = ms + report_tmc_status_interval;
+      #else
+        need_debug_reporting = false;
       #endif
 
+      if (!need_update_error_counters && !need_debug_reporting) return;
+
+      // Start a new pass
+      poll_index = 0;
+      step_down_axes = 0;
+    }
+
+    step_down_axes |= poll_tmc_driver(poll_index, need_update_error_counters, need_debug_reporting);
+
+    // Apply the results once every driver has reported
+    if (++poll_index >= POLL_DRIVER_COUNT) {
+      step_down_tmc_drivers(step_down_axes);
       if (TERN0(TMC_DEBUG, need_debug_reporting)) SERIAL_EOL();
     }
   }
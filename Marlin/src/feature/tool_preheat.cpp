@@ -0,0 +1,248 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/tool_preheat.cpp - Preheat the next tool ahead of its tool-change
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TOOLCHANGE_PREHEAT)
+
+#include "tool_preheat.h"
+#include "../gcode/queue.h"
+#include "../module/motion.h"
+#include "../module/temperature.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+ToolPreheat tool_preheat;
+
+int16_t ToolPreheat::print_temp[HOTENDS];
+float ToolPreheat::heat_rate[HOTENDS] = ARRAY_BY_HOTENDS1(TOOLCHANGE_PREHEAT_RATE);
+uint8_t ToolPreheat::standby_bits; // = 0
+
+#if ENABLED(SDSUPPORT)
+  int8_t ToolPreheat::found_tool = -1;
+  uint32_t ToolPreheat::found_pos, ToolPreheat::scan_pos;
+  float ToolPreheat::byte_rate; // = 0
+#endif
+
+/**
+ * Get the tool selected by a plain 'T<n>' line, skipping any line number.
+ * Return -1 for any other line, or for a 'T' that won't change tools.
+ */
+static int8_t tool_at_line(const char *p) {
+  while (*p == ' ') p++;
+  if (*p == 'N' && NUMERIC(p[1])) {
+    do p++; while (NUMERIC(*p));
+    while (*p == ' ') p++;
+  }
+  if (*p != 'T' || !NUMERIC(p[1])) return -1;
+  const int t = atoi(p + 1);
+  return (t < HOTENDS && t != active_extruder) ? t : -1;
+}
+
+float ToolPreheat::seconds_to_heat(const uint8_t e) {
+  const float rise = print_temp[e] - thermalManager.degHotend(e);
+  return _MAX(0, rise) / heat_rate[e] + (TOOLCHANGE_PREHEAT_MARGIN);
+}
+
+void ToolPreheat::preheat(const uint8_t e) {
+  CBI(standby_bits, e);
+  thermalManager.setTargetHotend(print_temp[e], e);
+  TERN_(HEATER_IDLE_HANDLER, thermalManager.reset_hotend_idle_timer(e));
+}
+
+/**
+ * Learn how fast each hotend heats. Only sample well below the target,
+ * where the heater is flat out and the rate is not yet tapering off.
+ */
+void ToolPreheat::learn_heat_rates(const millis_t &ms) {
+  static millis_t prev_ms;
+  static float prev_temp[HOTENDS];
+  const float dt = (ms - prev_ms) * 0.001f;
+  prev_ms = ms;
+  HOTEND_LOOP() {
+    const float temp = thermalManager.degHotend(e);
+    if (dt > 0 && dt < 5 && thermalManager.degTargetHotend(e) - temp > 10) {
+      const float rate = (temp - prev_temp[e]) / dt;
+      if (rate > 0.1f) heat_rate[e] += (rate - heat_rate[e]) * 0.2f;
+    }
+    prev_temp[e] = temp;
+  }
+}
+
+// Look for the next tool-change in the command queue
+int8_t ToolPreheat::scan_queue() {
+  for (uint8_t i = 0, r = queue.index_r; i < queue.length; i++, r = (r + 1) % (BUFSIZE)) {
+    const int8_t t = tool_at_line(queue.command_buffer[r]);
+    if (t >= 0) return t;
+  }
+  return -1;
+}
+
+#if ENABLED(SDSUPPORT)
+
+  // Learn how fast the print reads the file
+  void ToolPreheat::learn_byte_rate(const millis_t &ms) {
+    static millis_t prev_ms;
+    static uint32_t prev_pos;
+    const uint32_t sdpos = card.getIndex();
+    if (card.isPrinting() && sdpos > prev_pos && prev_pos) {
+      const float rate = (sdpos - prev_pos) / ((ms - prev_ms) * 0.001f);
+      byte_rate = byte_rate ? byte_rate + (rate - byte_rate) * 0.1f : rate;
+    }
+    else if (sdpos < prev_pos) {      // A new file
+      byte_rate = 0;
+      scan_pos = found_pos = 0;
+      found_tool = -1;
+    }
+    prev_ms = ms;
+    prev_pos = sdpos;
+  }
+
+  /**
+   * Look further along the file for the next tool-change. Read a few
+   * blocks per call, stop at the first T command found, and don't look
+   * beyond what the print will reach within TOOLCHANGE_PREHEAT_HORIZON.
+   */
+  void ToolPreheat::scan_file() {
+    static char line[16];               // Start of the line being scanned
+    static uint8_t line_len;
+    static bool collecting;
+    static uint32_t line_pos;
+
+    const uint32_t sdpos = card.getIndex();
+
+    if (found_tool >= 0) {
+      if (sdpos <= found_pos) return;   // Not there yet
+      found_tool = -1;
+      scan_pos = 0;
+    }
+
+    if (!scan_pos || scan_pos < sdpos) {
+      card.read_ahead_start(sdpos);
+      scan_pos = line_pos = sdpos;
+      line_len = 0;
+      collecting = true;
+    }
+
+    if (scan_pos - sdpos > byte_rate * (TOOLCHANGE_PREHEAT_HORIZON)) return;
+
+    auto check_line = [&]{
+      line[line_len] = '\0';
+      collecting = false;
+      const int8_t t = tool_at_line(line);
+      if (t < 0) return false;
+      found_tool = t;
+      found_pos = line_pos;
+      return true;
+    };
+
+    char buf[64];
+    LOOP_L_N(n, 8) {
+      const int16_t got = card.read_ahead(buf, sizeof(buf));
+      if (got <= 0) return;
+      LOOP_L_N(i, got) {
+        const char c = buf[i];
+        if (c == '\n' || c == '\r') {
+          if (collecting && check_line()) return;
+          collecting = true;
+          line_len = 0;
+          line_pos = scan_pos + i + 1;
+        }
+        else if (collecting) {
+          line[line_len++] = c;
+          if (line_len == COUNT(line) - 1 && check_line()) return;
+        }
+      }
+      scan_pos += got;
+    }
+  }
+
+#endif // SDSUPPORT
+
+/**
+ * Called from manage_inactivity. Once per second learn the rates, find
+ * the next tool-change, and start heating its tool when the time left
+ * until the swap is no more than the time it needs to heat.
+ */
+void ToolPreheat::update() {
+  static millis_t next_ms;
+  const millis_t ms = millis();
+  if (PENDING(ms, next_ms)) return;
+  next_ms = ms + 1000UL;
+
+  learn_heat_rates(ms);
+  TERN_(SDSUPPORT, learn_byte_rate(ms));
+
+  // A tool given a new target is no longer on standby
+  HOTEND_LOOP()
+    if (TEST(standby_bits, e) && thermalManager.degTargetHotend(e) != standby_temp(e))
+      CBI(standby_bits, e);
+
+  if (!standby_bits) return;
+
+  int8_t tool = scan_queue();
+  float secs = 0;
+
+  #if ENABLED(SDSUPPORT)
+    if (tool < 0 && card.isPrinting()) {
+      scan_file();
+      if (found_tool >= 0 && byte_rate > 0) {
+        tool = found_tool;
+        secs = (found_pos - card.getIndex()) / byte_rate;
+      }
+    }
+  #endif
+
+  if (tool >= 0 && TEST(standby_bits, tool) && secs <= seconds_to_heat(tool))
+    preheat(tool);
+}
+
+// At the start of a tool-change bring the new tool back up from standby
+void ToolPreheat::select(const uint8_t tool) {
+  if (TEST(standby_bits, tool)) preheat(tool);
+}
+
+// Once the old tool is unloaded drop it to standby until it's needed again
+void ToolPreheat::standby(const uint8_t tool) {
+  const int16_t target = thermalManager.degTargetHotend(tool);
+  if (target > 0) {
+    print_temp[tool] = target;
+    thermalManager.setTargetHotend(standby_temp(tool), tool);
+    SBI(standby_bits, tool);
+  }
+}
+
+// Wait for the new tool only if it's still heating up
+void ToolPreheat::ready(const uint8_t tool) {
+  if (thermalManager.degHotend(tool) < thermalManager.degTargetHotend(tool) - (TEMP_HYSTERESIS)) {
+    TERN_(HAS_DISPLAY, thermalManager.set_heating_message(tool));
+    (void)thermalManager.wait_for_hotend(tool, false);
+  }
+}
+
+#endif // TOOLCHANGE_PREHEAT
@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/tool_preheat.h - Preheat the next tool ahead of its tool-change
+ *
+ * A tool-change drops the outgoing tool to a standby temperature. The next
+ * T command is found in the command queue or, when printing from SD, further
+ * along the file. The time until the swap comes from the rate the print is
+ * reading the file, and the time to heat from a rate learned per hotend, so
+ * the tool on standby is brought back up just in time for its swap.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class ToolPreheat {
+public:
+  static int16_t print_temp[HOTENDS];   // Target restored when a tool on standby is needed again
+  static float heat_rate[HOTENDS];      // (°C/s) Learned heating rate
+
+  static void update();
+  static void select(const uint8_t tool);
+  static void standby(const uint8_t tool);
+  static void ready(const uint8_t tool);
+
+private:
+  static uint8_t standby_bits;          // Tools dropped to standby by a tool-change
+
+  static int16_t standby_temp(const uint8_t e) { return _MAX(0, print_temp[e] - (TOOLCHANGE_PREHEAT_STANDBY_DROP)); }
+  static float seconds_to_heat(const uint8_t e);
+  static void preheat(const uint8_t e);
+  static void learn_heat_rates(const millis_t &ms);
+  static int8_t scan_queue();
+
+  #if ENABLED(SDSUPPORT)
+    static int8_t found_tool;           // Next tool found in the file, or -1
+    static uint32_t found_pos,          // File position of the T command found
+                    scan_pos;           // File position of the scan, or 0 to restart
+    static float byte_rate;             // (bytes/s) Rate the print reads the file
+    static void learn_byte_rate(const millis_t &ms);
+    static void scan_file();
+  #endif
+};
+
+extern ToolPreheat tool_preheat;
@@ -68,20 +68,6 @@
   #include "../../../module/tool_change.h"
 #endif
 
-#if ABL_GRID
-  #if ENABLED(PROBE_Y_FIRST)
-    #define PR_OUTER_VAR meshCount.x
-    #define PR_OUTER_END abl_grid_points.x
-    #define PR_INNER_VAR meshCount.y
-    #define PR_INNER_END abl_grid_points.y
-  #else
-    #define PR_OUTER_VAR meshCount.y
-    #define PR_OUTER_END abl_grid_points.y
-    #define PR_INNER_VAR meshCount.x
-    #define PR_INNER_END abl_grid_points.x
-  #endif
-#endif
-
 #define G29_RETURN(b) return TERN_(G29_RETRY_AND_RECOVER, b)
 
 /**
@@ -602,37 +588,67 @@ G29_TYPE GcodeSuite::G29() {
 
     #if ABL_GRID
 
-      bool zig = PR_OUTER_END & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
-
       measured_z = 0;
 
       xy_int8_t meshCount;
 
-      // Outer loop is X with PROBE_Y_FIRST enabled
-      // Outer loop is Y with PROBE_Y_FIRST disabled
-      for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_END && !isnan(measured_z); PR_OUTER_VAR++) {
+      #if ENABLED(FAST_GRID_PROBING)
+
+        // Run the long rows along the axis that gets through them quicker
+        const float vx = _MIN(XY_PROBE_FEEDRATE_MM_S, planner.settings.max_feedrate_mm_s[X_AXIS]),
+                    vy = _MIN(XY_PROBE_FEEDRATE_MM_S, planner.settings.max_feedrate_mm_s[Y_AXIS]),
+                    tx = gridSpacing.x / vx, ty = gridSpacing.y / vy,
+                    rows_x = abl_grid_points.y * (abl_grid_points.x - 1) * tx + (abl_grid_points.y - 1) * ty,
+                    rows_y = abl_grid_points.x * (abl_grid_points.y - 1) * ty + (abl_grid_points.x - 1) * tx;
+        const bool y_first = rows_y < rows_x || (rows_y == rows_x && ENABLED(PROBE_Y_FIRST));
+
+        // Start at the grid corner nearest the probe
+        const xy_pos_t here = { current_position.x + probe.offset_xy.x, current_position.y + probe.offset_xy.y },
+                       mid = (probe_position_lf + probe_position_rb) * 0.5f;
+        const bool outer_rev = y_first ? here.x > mid.x : here.y > mid.y;
+        bool zig = !(y_first ? here.y > mid.y : here.x > mid.x);
+
+        probe.grid_walk(true);
+
+      #else
+
+        constexpr bool y_first = ENABLED(PROBE_Y_FIRST), outer_rev = false;
+        bool zig = (y_first ? abl_grid_points.x : abl_grid_points.y) & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
+
+      #endif
+
+      // Outer loop is X when probing along Y, otherwise Y
+      int8_t &outer_var = y_first ? meshCount.x : meshCount.y,
+             &inner_var = y_first ? meshCount.y : meshCount.x;
+      const int8_t outer_end = y_first ? abl_grid_points.x : abl_grid_points.y,
+                   inner_end = y_first ? abl_grid_points.y : abl_grid_points.x;
+
+      // An index to print current state
+      uint8_t pt_index = 0;
+
+      for (int8_t o = 0; o < outer_end && !isnan(measured_z); o++) {
+
+        outer_var = outer_rev ? outer_end - 1 - o : o;
 
         int8_t inStart, inStop, inInc;
 
         if (zig) {                    // Zig away from origin
           inStart = 0;                // Left or front
-          inStop = PR_INNER_END;      // Right or back
+          inStop = inner_end;         // Right or back
           inInc = 1;                  // Zig right
         }
         else {                        // Zag towards origin
-          inStart = PR_INNER_END - 1; // Right or back
+          inStart = inner_end - 1;    // Right or back
           inStop = -1;                // Left or front
           inInc = -1;                 // Zag left
         }
 
         zig ^= true; // zag
 
-        // An index to print current state
-        uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_END) + 1;
+        // Inner loop is Y when probing along Y, otherwise X
+        for (inner_var = inStart; inner_var != inStop; inner_var += inInc) {
 
-        // Inner loop is Y with PROBE_Y_FIRST enabled
-        // Inner loop is X with PROBE_Y_FIRST disabled
-        for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
+          pt_index++;
 
           probePos = probe_position_lf + gridSpacing * meshCount.asFloat();
 
@@ -680,6 +696,8 @@ G29_TYPE GcodeSuite::G29() {
         } // inner
       } // outer
 
+      TERN_(FAST_GRID_PROBING, probe.grid_walk(false));
+
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
       // Probe at 3 arbitrary points
@@ -30,10 +30,10 @@
 
 void echo_yes_no(const bool yes);
 
-inline void L6470_say_status(const L64XX_axis_t axis) {
+inline void L6470_say_status(const L64XX_axis_t axis, const uint16_t raw) {
   if (L64xxManager.spi_abort) return;
   const L64XX_Marlin::L64XX_shadow_t &sh = L64xxManager.shadow;
-  L64xxManager.get_status(axis);
+  L64xxManager.get_status(axis, raw);
   L64xxManager.say_axis(axis);
   #if ENABLED(L6470_CHITCHAT)
     char temp_buf[20];
@@ -94,53 +94,60 @@ void GcodeSuite::M122() {
   //  tmc_set_report_interval(parser.value_bool());
   //else
 
-  #if AXIS_IS_L64XX(X)
-    L6470_say_status(X);
-  #endif
-  #if AXIS_IS_L64XX(X2)
-    L6470_say_status(X2);
-  #endif
-  #if AXIS_IS_L64XX(Y)
-    L6470_say_status(Y);
-  #endif
-  #if AXIS_IS_L64XX(Y2)
-    L6470_say_status(Y2);
-  #endif
-  #if AXIS_IS_L64XX(Z)
-    L6470_say_status(Z);
-  #endif
-  #if AXIS_IS_L64XX(Z2)
-    L6470_say_status(Z2);
-  #endif
-  #if AXIS_IS_L64XX(Z3)
-    L6470_say_status(Z3);
-  #endif
-  #if AXIS_IS_L64XX(Z4)
-    L6470_say_status(Z4);
-  #endif
-  #if AXIS_IS_L64XX(E0)
-    L6470_say_status(E0);
-  #endif
-  #if AXIS_IS_L64XX(E1)
-    L6470_say_status(E1);
-  #endif
-  #if AXIS_IS_L64XX(E2)
-    L6470_say_status(E2);
-  #endif
-  #if AXIS_IS_L64XX(E3)
-    L6470_say_status(E3);
-  #endif
-  #if AXIS_IS_L64XX(E4)
-    L6470_say_status(E4);
-  #endif
-  #if AXIS_IS_L64XX(E5)
-    L6470_say_status(E5);
-  #endif
-  #if AXIS_IS_L64XX(E6)
-    L6470_say_status(E6);
-  #endif
-  #if AXIS_IS_L64XX(E7)
-    L6470_say_status(E7);
+  uint16_t raw[MAX_L64XX];          // Read the whole chain in one pass
+  if (L64xxManager.get_all_status(raw)) {
+    #if AXIS_IS_L64XX(X)
+      L6470_say_status(X, raw[X]);
+    #endif
+    #if AXIS_IS_L64XX(X2)
+      L6470_say_status(X2, raw[X2]);
+    #endif
+    #if AXIS_IS_L64XX(Y)
+      L6470_say_status(Y, raw[Y]);
+    #endif
+    #if AXIS_IS_L64XX(Y2)
+      L6470_say_status(Y2, raw[Y2]);
+    #endif
+    #if AXIS_IS_L64XX(Z)
+      L6470_say_status(Z, raw[Z]);
+    #endif
+    #if AXIS_IS_L64XX(Z2)
+      L6470_say_status(Z2, raw[Z2]);
+    #endif
+    #if AXIS_IS_L64XX(Z3)
+      L6470_say_status(Z3, raw[Z3]);
+    #endif
+    #if AXIS_IS_L64XX(Z4)
+      L6470_say_status(Z4, raw[Z4]);
+    #endif
+    #if AXIS_IS_L64XX(E0)
+      L6470_say_status(E0, raw[E0]);
+    #endif
+    #if AXIS_IS_L64XX(E1)
+      L6470_say_status(E1, raw[E1]);
+    #endif
+    #if AXIS_IS_L64XX(E2)
+      L6470_say_status(E2, raw[E2]);
+    #endif
+    #if AXIS_IS_L64XX(E3)
+      L6470_say_status(E3, raw[E3]);
+    #endif
+    #if AXIS_IS_L64XX(E4)
+      L6470_say_status(E4, raw[E4]);
+    #endif
+    #if AXIS_IS_L64XX(E5)
+      L6470_say_status(E5, raw[E5]);
+    #endif
+    #if AXIS_IS_L64XX(E6)
+      L6470_say_status(E6, raw[E6]);
+    #endif
+    #if AXIS_IS_L64XX(E7)
+      L6470_say_status(E7, raw[E7]);
+    #endif
+  }
+
+  #if ENABLED(MONITOR_L6470_DRIVER_STATUS)
+    SERIAL_ECHOLNPAIR("SPI chain: ", L64xxManager.poll_frames, " frames, ", L64xxManager.poll_bytes, " bytes per poll");
   #endif
 
   L64xxManager.spi_active = false;   // done with all SPI transfers - clear handshake flags
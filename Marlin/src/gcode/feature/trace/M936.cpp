@@ -19,31 +19,29 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  *
  */
-#ifdef __PLAT_LINUX__
 
-#include "IOLoggerCSV.h"
+#include "../../../inc/MarlinConfig.h"
 
-IOLoggerCSV::IOLoggerCSV(std::string filename) {
-  file.open(filename);
-}
-
-IOLoggerCSV::~IOLoggerCSV() {
-  file.close();
-}
+#if ENABLED(STEPPER_TRACE)
 
-void IOLoggerCSV::log(GpioEvent ev) {
-  std::lock_guard<std::mutex> lock(vector_lock);
-  events.push_back(ev); //minimal impact to signal handler
-}
+#include "../../gcode.h"
+#include "../../../feature/stepper_trace.h"
 
-void IOLoggerCSV::flush() {
-  { std::lock_guard<std::mutex> lock(vector_lock);
-    while (!events.empty()) {
-      file << events.front().timestamp << ", "<< events.front().pin_id << ", " << events.front().event << std::endl;
-      events.pop_front();
-    }
+/**
+ * M936: Stepper ISR trace
+ *
+ *   S1 - Clear the buffer and start tracing
+ *   S0 - Stop tracing
+ *
+ * With no S parameter, stop tracing and dump the buffer.
+ * Decode the capture with buildroot/share/scripts/stepper_trace.py.
+ */
+void GcodeSuite::M936() {
+  if (parser.seen('S')) {
+    if (parser.value_bool()) stepper_trace.start(); else stepper_trace.stop();
   }
-  file.flush();
+  else
+    stepper_trace.dump();
 }
 
-#endif // __PLAT_LINUX__
+#endif // STEPPER_TRACE
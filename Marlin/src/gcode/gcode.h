@@ -48,6 +48,7 @@
  * G3   - CCW ARC
  * G4   - Dwell S<seconds> or P<milliseconds>
  * G5   - Cubic B-spline with XYZE destination and IJPQ offsets
+ * G7   - Laser raster line with per-pixel power D<hex> (Requires LASER_RASTER)
  * G10  - Retract filament according to settings of M207 (Requires FWRETRACT)
  * G11  - Retract recover filament according to settings of M208 (Requires FWRETRACT)
  * G12  - Clean tool (Requires NOZZLE_CLEAN_FEATURE)
@@ -163,6 +164,7 @@
  * M166 - Set the Gradient Mix for the mixing extruder. (Requires GRADIENT_MIX)
  * M190 - S<temp> Wait for bed current temp to reach target temp. ** Wait only when heating! **
  *        R<temp> Wait for bed current temp to reach target temp. ** Wait for heating or cooling. **
+ * M199 - Heat the hotend and bed while homing, probing and moving to the purge position. (Requires JOB_START_SCHEDULER)
  * M200 - Set filament diameter, D<diameter>, setting E axis units to cubic. (Use S0 to revert to linear units.)
  * M201 - Set max acceleration in units/s^2 for print moves: "M201 X<accel> Y<accel> Z<accel> E<accel>"
  * M202 - Set max acceleration in units/s^2 for travel moves: "M202 X<accel> Y<accel> Z<accel> E<accel>" ** UNUSED IN MARLIN! **
@@ -197,6 +199,7 @@
  * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. (Requires PIDTEMP)
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
  * M305 - Set user thermistor parameters R T and P. (Requires TEMP_SENSOR_x 1000)
+ * M306 - Set or report MPC hotend model constants P C R A F H. 'M306 T' to autotune. (Requires MPCTEMP)
  * M350 - Set microstepping mode. (Requires digital microstepping pins.)
  * M351 - Toggle MS1 MS2 pins directly. (Requires digital microstepping pins.)
  * M355 - Set Case Light on/off and set brightness. (Requires CASE_LIGHT_PIN)
@@ -279,6 +282,7 @@
  * ************ Custom codes - This can change to suit future G-code regulations
  * G425 - Calibrate using a conductive object. (Requires CALIBRATION_GCODE)
  * M928 - Start SD logging: "M928 filename.gco". Stop with M29. (Requires SDSUPPORT)
+ * M936 - Stepper ISR trace: S1 start, S0 stop, no S to dump. (Requires STEPPER_TRACE)
  * M993 - Backup SPI Flash to SD
  * M994 - Load a Backup from SD to SPI Flash
  * M995 - Touch screen calibration for TFT display
@@ -419,6 +423,8 @@ private:
 
   TERN_(DIRECT_STEPPING, static void G6());
 
+  TERN_(LASER_RASTER, static void G7());
+
   #if ENABLED(FWRETRACT)
     static void G10();
     static void G11();
@@ -621,6 +627,8 @@ private:
     static void M191();
   #endif
 
+  TERN_(JOB_START_SCHEDULER, static void M199());
+
   #if PREHEAT_COUNT
     static void M145();
   #endif
@@ -703,6 +711,8 @@ private:
 
   TERN_(HAS_USER_THERMISTORS, static void M305());
 
+  TERN_(MPCTEMP, static void M306());
+
   #if HAS_MICROSTEPS
     static void M350();
     static void M351();
@@ -859,6 +869,8 @@ private:
 
   TERN_(SDSUPPORT, static void M928());
 
+  TERN_(STEPPER_TRACE, static void M936());
+
   TERN_(MAGNETIC_PARKING_EXTRUDER, static void M951());
 
   TERN_(TOUCH_SCREEN_CALIBRATION, static void M995());
@@ -35,12 +35,144 @@
   #include "../../module/stepper.h"
 #endif
 
+#if ENABLED(G1_MOVE_COALESCING)
+  #include "../queue.h"
+  #if ENABLED(CANCEL_OBJECTS)
+    #include "../../feature/cancel_object.h"
+  #endif
+  #if ENABLED(PRINTCOUNTER)
+    #include "../../module/printcounter.h"
+  #endif
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    #include "../../feature/powerloss.h"
+  #endif
+  #if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+    #include "../../feature/mmu2/mmu2.h"
+  #endif
+#endif
+
 extern xyze_pos_t destination;
 
 #if ENABLED(VARIABLE_G0_FEEDRATE)
   feedRate_t fast_move_feedrate = MMM_TO_MMS(G0_FEEDRATE);
 #endif
 
+#if ENABLED(G1_MOVE_COALESCING)
+
+  /**
+   * Is the parsed command a G1 with nothing but X Y Z E F words?
+   * Anything else (laser power, mixing factors, ...) keeps its own block.
+   */
+  static bool is_plain_g1() {
+    if (parser.command_letter != 'G' || parser.codenum != 1 || TERN0(USE_GCODE_SUBCODES, parser.subcode)) return false;
+    for (const char *p = parser.command_ptr + 1; *p; ++p) {
+      char c = *p;
+      if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z'))) c += 'A' - 'a';
+      if (WITHIN(c, 'A', 'Z') && c != 'X' && c != 'Y' && c != 'Z' && c != 'E' && c != 'F') return false;
+    }
+    return true;
+  }
+
+  /**
+   * Is the raw queued command a plain G1? Checked before parsing, since parse()
+   * modifies the command in place (e.g., unescaping GCODE_QUOTED_STRINGS) and
+   * would do it again when the command takes its turn.
+   */
+  static bool is_plain_g1_text(const char *p) {
+    auto uppercase = [](char c) {
+      if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z'))) c += 'A' - 'a';
+      return c;
+    };
+    while (*p == ' ') ++p;
+    if (uppercase(*p) == 'N' && NUMERIC_SIGNED(p[1])) { // Skip a line number
+      p += 2;
+      while (NUMERIC(*p)) ++p;
+      while (*p == ' ') ++p;
+    }
+    if (uppercase(*p++) != 'G') return false;
+    while (*p == ' ') ++p;
+    if (*p++ != '1' || NUMERIC(*p) || *p == '.') return false;
+    for (; *p && *p != '*'; ++p) {
+      const char c = uppercase(*p);
+      if (c == '"' || (WITHIN(c, 'A', 'Z') && c != 'X' && c != 'Y' && c != 'Z' && c != 'E' && c != 'F')) return false;
+    }
+    return true;
+  }
+
+  /**
+   * Can point 'p' be dropped from the path a -> p -> b? It must project inside
+   * the segment a-b, lie within COALESCE_MAX_DEVIATION of it, and have the E
+   * position the combined move would extrude at that point.
+   */
+  static bool on_segment(const xyze_pos_t &a, const xyze_pos_t &b, const xyze_pos_t &p) {
+    const xyz_pos_t ab = b - a, ap = p - a;
+    const float len_sq = sq(ab.x) + sq(ab.y) + sq(ab.z);
+    if (len_sq < sq(COALESCE_MAX_DEVIATION)) return false;
+    const float t = (ap.x * ab.x + ap.y * ab.y + ap.z * ab.z) / len_sq;
+    if (t <= 0 || t >= 1) return false;
+    const xyz_pos_t off = ap - ab * t;
+    if (sq(off.x) + sq(off.y) + sq(off.z) > sq(COALESCE_MAX_DEVIATION)) return false;
+    const float e_ratio = (b.e - a.e) * RSQRT(len_sq);
+    return ABS(p.e - (a.e + (b.e - a.e) * t)) <= COALESCE_MAX_DEVIATION * ABS(e_ratio);
+  }
+
+  /**
+   * Fold the G1 commands queued behind this one into 'destination' for as long
+   * as they continue the same straight line at the same feedrate and flow.
+   * Each merged command is retired from the queue with its "ok" sent.
+   */
+  static void coalesce_queued_moves() {
+    // Only moves taken from the queue, not injected or sub-commands
+    const char * const cmd = queue.command_buffer[queue.index_r];
+    if (!WITHIN(parser.command_ptr, cmd, cmd + MAX_CMD_SIZE - 1)) return;
+    if (TERN0(CANCEL_OBJECTS, cancelable.skipping) || !is_plain_g1()) return;
+
+    // A merged extruding move would slip past the wait for the MMU
+    if (TERN0(MMU2_ASYNC_TOOL_CHANGE, mmu2.tool_change_pending())) return;
+
+    for (;;) {
+      char * const next_cmd = queue.peek_next_command();
+      if (!next_cmd || !is_plain_g1_text(next_cmd)) break;
+
+      parser.parse(next_cmd);
+      if (parser.linearval('F') > 0 && parser.value_feedrate() != feedrate_mm_s) break;
+
+      // The next target, continuing from this move's destination
+      xyze_pos_t target;
+      LOOP_XYZE(i) {
+        if (parser.seenval(axis_codes[i])) {
+          const float v = parser.value_axis_units((AxisEnum)i);
+          target[i] = GcodeSuite::axis_is_relative(AxisEnum(i)) ? destination[i] + v
+                    : (i == E_AXIS ? v : LOGICAL_TO_NATIVE(v, i));
+        }
+        else
+          target[i] = destination[i];
+      }
+
+      // The last joint must lie on the longer line
+      if (!on_segment(current_position, target, destination)) break;
+
+      #if ENABLED(PRINTCOUNTER)
+        if (!DEBUGGING(DRYRUN)) print_job_timer.incFilamentUsed(target.e - destination.e);
+      #endif
+
+      #if ENABLED(POWER_LOSS_RECOVERY) && !PIN_EXISTS(POWER_LOSS)
+        // Save as get_destination_from_command() would have for this move
+        if (recovery.enabled && IS_SD_PRINTING() && parser.seenval('E') && (parser.seenval('X') || parser.seenval('Y'))) {
+          const xyze_pos_t oldpos = current_position;
+          current_position = destination;
+          recovery.save();
+          current_position = oldpos;
+        }
+      #endif
+
+      destination = target;
+      queue.retire_current_command();
+    }
+  }
+
+#endif // G1_MOVE_COALESCING
+
 /**
  * G0, G1: Coordinated movement of X Y Z E axes
  */
@@ -99,6 +231,10 @@ void GcodeSuite::G0_G1(
 
     #endif // FWRETRACT
 
+    #if ENABLED(G1_MOVE_COALESCING)
+      coalesce_queued_moves();
+    #endif
+
     #if IS_SCARA
       fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
     #else
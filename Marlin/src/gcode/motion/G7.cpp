@@ -0,0 +1,89 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LASER_RASTER)
+
+#include "../gcode.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+#include "../../MarlinCore.h"
+
+static int8_t hex_nybble(const char c) {
+  if (NUMERIC(c)) return c - '0';
+  if (WITHIN(c, 'A', 'F')) return c - 'A' + 10;
+  if (WITHIN(c, 'a', 'f')) return c - 'a' + 10;
+  return -1;
+}
+
+/**
+ * G7: Laser Raster Line
+ *
+ * Move in a straight line while burning a row of pixels, all in one
+ * planner block. The pixels are spread evenly along the move and the
+ * stepper ISR changes the laser power as the head crosses each one.
+ *
+ *  X Y Z  The end of the line, as with G1
+ *  F      Feedrate
+ *  S      Laser power for a full-value pixel (with LASER_MOVE_POWER)
+ *  D      Pixel values, two hex digits each (00-FF). Must be the last parameter.
+ *
+ * Pixel values scale the inline laser power, so 'M3 S<power> I' (or 'S')
+ * sets the full-scale power and 'D00' leaves the laser off.
+ */
+void GcodeSuite::G7() {
+  if (!IsRunning()) return;
+
+  #if ENABLED(NO_MOTION_BEFORE_HOMING)
+    if (axis_unhomed_error(
+        (parser.seen('X') ? _BV(X_AXIS) : 0)
+      | (parser.seen('Y') ? _BV(Y_AXIS) : 0)
+      | (parser.seen('Z') ? _BV(Z_AXIS) : 0) )
+    ) return;
+  #endif
+
+  get_destination_from_command();                   // Get X Y Z F (and set cutter power)
+
+  laser_raster_t &raster = planner.laser_inline.raster;
+  const uint8_t full_power = planner.laser_inline.power;
+  raster.pixels = 0;
+  for (const char *p = parser.string_arg; p && *p && *p != ' '; p += 2) {
+    const int8_t hi = hex_nybble(p[0]), lo = hex_nybble(p[1]);
+    if (hi < 0 || lo < 0) break;
+    if (raster.pixels >= LASER_RASTER_MAX_PIXELS) {
+      SERIAL_ERROR_MSG("G7 line exceeds LASER_RASTER_MAX_PIXELS");
+      raster.pixels = 1;                            // Keep the position but burn nothing
+      raster.power[0] = 0;
+      break;
+    }
+    raster.power[raster.pixels++] = (uint16_t(full_power) * uint8_t((hi << 4) | lo)) / 255;
+  }
+
+  // One block for the whole line. Never split by mesh segmentation.
+  apply_motion_limits(destination);
+  planner.buffer_line(destination, MMS_SCALED(feedrate_mm_s), active_extruder);
+  current_position = destination;
+
+  raster.pixels = 0;                                // Never leak into a later block
+}
+
+#endif // LASER_RASTER
@@ -280,6 +280,15 @@ void GCodeParser::parse(char *p) {
       return;
     }
 
+    #if ENABLED(LASER_RASTER)
+      // Special handling for G7 ... D<hex pixels>
+      // The pixel data must be the last parameter
+      if (param == 'D' && letter == 'G' && codenum == 7) {
+        string_arg = p;                           // Hex digits start after 'D'
+        return;
+      }
+    #endif
+
     #if ENABLED(GCODE_QUOTED_STRINGS)
       if (!quoted_string_arg && param == '"') {
         quoted_string_arg = true;
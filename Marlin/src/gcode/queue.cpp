@@ -562,30 +562,38 @@ void GCodeQueue::get_serial_commands() {
     if (!IS_SD_PRINTING()) return;
 
     int sd_count = 0;
-    bool card_eof = card.eof();
-    while (length < BUFSIZE && !card_eof) {
-      const int16_t n = card.get();
-      card_eof = card.eof();
-      if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
-
-      const char sd_char = (char)n;
-      const bool is_eol = ISEOL(sd_char);
-      if (is_eol || card_eof) {
-
-        // Reset stream state, terminate the buffer, and commit a non-empty command
-        if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
+    while (length < BUFSIZE) {
+      // Scan straight out of the SD block cache. Nothing else may touch
+      // the card until the scanned bytes are consumed.
+      const uint8_t *data;
+      const int16_t avail = card.peek_block(data);
+      if (avail < 0) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+
+      if (avail == 0) {
+        // Commit a final line with no newline, then handle end of file
         if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
           _commit_command(false);
-          #if ENABLED(POWER_LOSS_RECOVERY)
-            recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
-          #endif
+          TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
         }
-
-        if (card_eof) card.fileHasFinished();         // Handle end of file reached
+        card.fileHasFinished();
+        break;
       }
-      else
-        process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
 
+      int16_t i = 0;
+      while (i < avail) {
+        const char sd_char = data[i++];
+        if (ISEOL(sd_char)) {
+          // Reset stream state, terminate the buffer, and commit a non-empty command
+          if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
+            _commit_command(false);
+            TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex() + i); // Prime for the NEXT _commit_command
+            if (length >= BUFSIZE) break;
+          }
+        }
+        else
+          process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
+      }
+      card.consume(i);
     }
   }
 
@@ -658,3 +666,24 @@ void GCodeQueue::advance() {
   if (++index_r >= BUFSIZE) index_r = 0;
 
 }
+
+#if ENABLED(G1_MOVE_COALESCING)
+
+  char* GCodeQueue::peek_next_command() {
+    if (length < 2) return nullptr;
+    // Commands logged or saved to SD are written before they are processed
+    if (TERN0(SDSUPPORT, card.flag.saving)) return nullptr;
+    const uint8_t next = (index_r + 1) % BUFSIZE;
+    // The "ok" for a merged command must go back to the same host
+    if (TERN0(HAS_MULTI_SERIAL, port[next] != port[index_r])) return nullptr;
+    return command_buffer[next];
+  }
+
+  void GCodeQueue::retire_current_command() {
+    ok_to_send();
+    --length;
+    if (++index_r >= BUFSIZE) index_r = 0;
+    TERN_(POWER_LOSS_RECOVERY, recovery.queue_index_r = index_r);
+  }
+
+#endif
@@ -147,6 +147,20 @@ public:
    */
   static void flush_and_request_resend();
 
+  #if ENABLED(G1_MOVE_COALESCING)
+    /**
+     * Get the command queued behind the one being processed,
+     * or nullptr if there is none that may be folded into it.
+     */
+    static char* peek_next_command();
+
+    /**
+     * Finish the command being processed so the one behind it
+     * becomes current. Used when that command has been merged in.
+     */
+    static void retire_current_command();
+  #endif
+
 private:
 
   static uint8_t index_w;  // Ring buffer write position
@@ -26,6 +26,10 @@
 
 #include "../../MarlinCore.h" // for startOrResumeJob
 
+#if ENABLED(PRINTCOUNTER_JOB_LOG)
+  #include "../../feature/joblog.h"
+#endif
+
 /**
  * M75: Start print timer
  */
@@ -51,6 +55,10 @@ void GcodeSuite::M77() {
 
 /**
  * M78: Show print statistics
+ *
+ *  S78 - Reset the statistics
+ *  R   - Reset a service interval (with SERVICE_INTERVALS)
+ *  H   - Show histograms of the SD card job log (with PRINTCOUNTER_JOB_LOG)
  */
 void GcodeSuite::M78() {
   if (parser.intval('S') == 78) {  // "M78 S78" will reset the statistics
@@ -67,6 +75,10 @@ void GcodeSuite::M78() {
     }
   #endif
 
+  #if ENABLED(PRINTCOUNTER_JOB_LOG)
+    if (parser.seen('H')) return job_log.report();
+  #endif
+
   print_job_timer.showStats();
 }
 
@@ -0,0 +1,97 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * gcode/temp/M199.cpp
+ *
+ * Job start with concurrent heating
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(JOB_START_SCHEDULER)
+
+#include "../gcode.h"
+#include "../../module/temperature.h"
+#include "../../module/motion.h"
+#include "../../lcd/ultralcd.h"
+
+#if ENABLED(PRINTJOB_TIMER_AUTOSTART)
+  #include "../../module/printcounter.h"
+#endif
+
+/**
+ * M199: Heat up for a job while homing, probing and moving to the purge position
+ *
+ * Heating starts at once and the wait is put off until the motion is done:
+ *
+ *  1. Set the hotend and bed targets and home all axes.
+ *  2. Wait for the bed (unless JOB_START_PROBE_COLD_BED) and probe the mesh
+ *     with the hotend held at or below JOB_START_PROBE_TEMP to prevent oozing.
+ *  3. Raise the hotend to its target and travel to JOB_START_PURGE_POS.
+ *  4. Wait for the bed and hotend to finish heating.
+ *
+ * Parameters:
+ *  S<temp>   : Hotend target temperature
+ *  B<temp>   : Bed target temperature
+ *  T<index>  : Tool index. If omitted, applies to the active tool
+ *  P<bool>   : Probe the mesh. (Default: 1 with bed leveling)
+ */
+void GcodeSuite::M199() {
+
+  const int8_t target_extruder = get_target_extruder_from_command();
+  if (target_extruder < 0) return;
+
+  const int16_t hotend_temp = parser.seenval('S') ? parser.value_celsius() : thermalManager.degTargetHotend(target_extruder);
+  #if HAS_HEATED_BED
+    const int16_t bed_temp = parser.seenval('B') ? parser.value_celsius() : thermalManager.degTargetBed();
+  #endif
+  const bool do_probe = TERN0(HAS_LEVELING, parser.boolval('P', true));
+
+  // Start heating. The hotend stays below the oozing point until probing is done.
+  thermalManager.setTargetHotend(do_probe ? _MIN(hotend_temp, JOB_START_PROBE_TEMP) : hotend_temp, target_extruder);
+  TERN_(HAS_HEATED_BED, thermalManager.setTargetBed(bed_temp));
+  TERN_(PRINTJOB_TIMER_AUTOSTART, thermalManager.check_timer_autostart(true, true));
+
+  home_all_axes();
+
+  #if HAS_LEVELING
+    if (do_probe) {
+      #if HAS_HEATED_BED && DISABLED(JOB_START_PROBE_COLD_BED)
+        TERN_(HAS_DISPLAY, thermalManager.set_heating_message(target_extruder));
+        if (!thermalManager.wait_for_bed()) return;
+      #endif
+      process_subcommands_now_P(PSTR(JOB_START_PROBE_GCODE));
+      thermalManager.setTargetHotend(hotend_temp, target_extruder);
+    }
+  #endif
+
+  // Travel to the purge position while the hotend finishes heating
+  const xyz_pos_t purge_pos = JOB_START_PURGE_POS;
+  do_blocking_move_to(purge_pos);
+
+  TERN_(HAS_DISPLAY, thermalManager.set_heating_message(target_extruder));
+  if (TERN1(HAS_HEATED_BED, thermalManager.wait_for_bed()))
+    (void)thermalManager.wait_for_hotend(target_extruder);
+}
+
+#endif // JOB_START_SCHEDULER
@@ -0,0 +1,95 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MPCTEMP)
+
+#include "../gcode.h"
+#include "../../lcd/ultralcd.h"
+#include "../../module/motion.h"
+#include "../../module/temperature.h"
+
+/**
+ * M306: MPC settings and autotune
+ *
+ *  E<extruder>             Extruder index. (Default: Active Extruder)
+ *  T                       Autotune the extruder and apply the results.
+ *
+ * Set the model constants of the extruder:
+ *  P<watts>                Heater power.
+ *  C<joules/kelvin>        Block heat capacity.
+ *  R<kelvin/s/kelvin>      Sensor responsiveness.
+ *  A<watts/kelvin>         Ambient heat transfer coefficient with the fan off.
+ *  F<watts/kelvin>         Ambient heat transfer coefficient with the fan on full. (Requires MPC_INCLUDE_FAN)
+ *  H<joules/kelvin/mm>     Filament heat capacity per mm.
+ *
+ * With no parameters report the constants of all extruders.
+ */
+void GcodeSuite::M306() {
+  const bool seen_e = parser.seenval('E');
+  const uint8_t e = seen_e ? parser.value_byte() : active_extruder;
+  if (e >= HOTENDS) {
+    SERIAL_ERROR_MSG(STR_INVALID_EXTRUDER);
+    return;
+  }
+
+  if (parser.seen('T')) {
+    #if DISABLED(BUSY_WHILE_HEATING)
+      KEEPALIVE_STATE(NOT_BUSY);
+    #endif
+    ui.set_status_P(PSTR("MPC autotune"));
+    thermalManager.MPC_autotune(e);
+    ui.reset_status();
+    return;
+  }
+
+  if (parser.seen("PCRAFH")) {
+    MPC_t &constants = thermalManager.temp_hotend[e].constants;
+    if (parser.seenval('P')) constants.heater_power = parser.value_float();
+    if (parser.seenval('C')) constants.block_heat_capacity = parser.value_float();
+    if (parser.seenval('R')) constants.sensor_responsiveness = parser.value_float();
+    if (parser.seenval('A')) constants.ambient_xfer_coeff_fan0 = parser.value_float();
+    #if ENABLED(MPC_INCLUDE_FAN)
+      if (parser.seenval('F')) constants.fan255_adjustment = parser.value_float() - constants.ambient_xfer_coeff_fan0;
+    #endif
+    if (parser.seenval('H')) constants.filament_heat_capacity_permm = parser.value_float();
+    return;
+  }
+
+  LOOP_L_N(i, HOTENDS) {
+    if (seen_e && i != e) continue;
+    const MPC_t &constants = thermalManager.temp_hotend[i].constants;
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("  M306 E", int(i));
+    SERIAL_ECHOPAIR_F(" P", constants.heater_power, 2);
+    SERIAL_ECHOPAIR_F(" C", constants.block_heat_capacity, 2);
+    SERIAL_ECHOPAIR_F(" R", constants.sensor_responsiveness, 4);
+    SERIAL_ECHOPAIR_F(" A", constants.ambient_xfer_coeff_fan0, 4);
+    #if ENABLED(MPC_INCLUDE_FAN)
+      SERIAL_ECHOPAIR_F(" F", constants.ambient_xfer_coeff_fan0 + constants.fan255_adjustment, 4);
+    #endif
+    SERIAL_ECHOLNPAIR_F(" H", constants.filament_heat_capacity_permm, 4);
+  }
+}
+
+#endif // MPCTEMP
@@ -789,6 +789,15 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
       static_assert(BABYSTEP_MULTIPLICATOR_XY <= 0.25f, "BABYSTEP_MULTIPLICATOR_XY must be less than or equal to 0.25mm.");
     #endif
   #endif
+  #if ENABLED(BABYSTEP_PLANNED)
+    #if ENABLED(INTEGRATED_BABYSTEPPING)
+      #error "BABYSTEP_PLANNED and INTEGRATED_BABYSTEPPING are incompatible."
+    #elif IS_KINEMATIC
+      #error "BABYSTEP_PLANNED is not compatible with DELTA or SCARA."
+    #elif IS_CORE
+      #error "BABYSTEP_PLANNED is not compatible with COREXY, COREXZ, or COREYZ."
+    #endif
+  #endif
 #endif
 
 /**
@@ -1134,6 +1143,59 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "To use BED_LIMIT_SWITCHING you must disable PIDTEMPBED."
 #endif
 
+/**
+ * Queued tool-change moves
+ */
+#if ENABLED(TOOLCHANGE_QUEUED_MOVES)
+  #if EXTRUDERS < 2
+    #error "TOOLCHANGE_QUEUED_MOVES requires EXTRUDERS > 1."
+  #elif IS_KINEMATIC
+    #error "TOOLCHANGE_QUEUED_MOVES is not compatible with DELTA or SCARA."
+  #endif
+#endif
+
+/**
+ * Tool-change Preheat requirements
+ */
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #if !HAS_MULTI_HOTEND
+    #error "TOOLCHANGE_PREHEAT requires more than one hotend."
+  #elif TOOLCHANGE_PREHEAT_STANDBY_DROP < 0
+    #error "TOOLCHANGE_PREHEAT_STANDBY_DROP must be 0 or greater."
+  #endif
+  static_assert(TOOLCHANGE_PREHEAT_RATE > 0, "TOOLCHANGE_PREHEAT_RATE must be greater than 0.");
+#endif
+
+/**
+ * Job Start Scheduler requirements
+ */
+#if ENABLED(JOB_START_SCHEDULER)
+  #if !HAS_HOTEND
+    #error "JOB_START_SCHEDULER requires at least one hotend."
+  #elif !defined(JOB_START_PURGE_POS)
+    #error "JOB_START_SCHEDULER requires JOB_START_PURGE_POS."
+  #elif HAS_LEVELING && (!defined(JOB_START_PROBE_TEMP) || !defined(JOB_START_PROBE_GCODE))
+    #error "JOB_START_SCHEDULER requires JOB_START_PROBE_TEMP and JOB_START_PROBE_GCODE."
+  #endif
+#endif
+
+/**
+ * Hotend Heating Options - PID vs Model Predictive Control
+ */
+#if ENABLED(MPCTEMP)
+  #if ENABLED(PIDTEMP)
+    #error "MPCTEMP is an alternative to PIDTEMP. Please enable only one of them."
+  #elif !HAS_HOTEND
+    #error "MPCTEMP requires at least one hotend."
+  #elif ENABLED(MPC_INCLUDE_FAN) && !HAS_FAN
+    #error "MPC_INCLUDE_FAN requires at least one fan."
+  #elif !defined(MPC_TUNING_TEMP) || MPC_TUNING_TEMP < 100
+    #error "MPC_TUNING_TEMP must be 100 or more."
+  #endif
+  static_assert(WITHIN(MPC_SMOOTHING_FACTOR, 0.0f, 1.0f), "MPC_SMOOTHING_FACTOR must be between 0.0 and 1.0.");
+  static_assert(MPC_FLOW_LOOKAHEAD > 0, "MPC_FLOW_LOOKAHEAD must be greater than 0.");
+#endif
+
 /**
  * Kinematics
  */
@@ -1402,6 +1464,24 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "AUTO_BED_LEVELING_UBL used to enable RESTORE_LEVELING_AFTER_G28. To keep this behavior enable RESTORE_LEVELING_AFTER_G28. Otherwise define it as 'false'."
   #endif
 
+  #if ENABLED(UBL_ADAPTIVE_PROBING)
+    #if !HAS_BED_PROBE
+      #error "UBL_ADAPTIVE_PROBING requires a bed probe."
+    #elif !WITHIN(UBL_ADAPTIVE_STRIDE, 2, 4)
+      #error "UBL_ADAPTIVE_STRIDE must be between 2 and 4."
+    #endif
+    static_assert(UBL_ADAPTIVE_THRESHOLD > 0, "UBL_ADAPTIVE_THRESHOLD must be greater than 0.");
+  #endif
+
+  #if ENABLED(UBL_PRINT_AREA_PROBING)
+    #if !HAS_BED_PROBE
+      #error "UBL_PRINT_AREA_PROBING requires a bed probe."
+    #elif DISABLED(SDSUPPORT)
+      #error "UBL_PRINT_AREA_PROBING requires SDSUPPORT."
+    #endif
+    static_assert(UBL_PRINT_AREA_MARGIN >= 0, "UBL_PRINT_AREA_MARGIN must be 0 or greater.");
+  #endif
+
 #elif HAS_ABL_NOT_UBL
 
   /**
@@ -1911,6 +1991,10 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
 /**
  * Endstop Tests
  */
+#if BOTH(ENDSTOP_POLL_APPROACH_ONLY, ENDSTOP_NOISE_THRESHOLD)
+  #error "ENDSTOP_POLL_APPROACH_ONLY is incompatible with ENDSTOP_NOISE_THRESHOLD."
+#endif
+
 
 #define _PLUG_UNUSED_TEST(A,P) (DISABLED(USE_##P##MIN_PLUG, USE_##P##MAX_PLUG) \
   && !(ENABLED(A##_DUAL_ENDSTOPS) && WITHIN(A##2_USE_ENDSTOP, _##P##MAX_, _##P##MIN_)) \
@@ -2113,6 +2197,8 @@ static_assert(hbm[Z_AXIS] >= 0, "HOMING_BUMP_MM.Z must be greater than or equal
 #elif ENABLED(NEOPIXEL_LED)
   #if !(PIN_EXISTS(NEOPIXEL) && NEOPIXEL_PIXELS > 0)
     #error "NEOPIXEL_LED requires NEOPIXEL_PIN and NEOPIXEL_PIXELS."
+  #elif ENABLED(NEOPIXEL_DEFERRED_SHOW) && !(defined(NEOPIXEL_SHOW_INTERVAL) && defined(NEOPIXEL_FADE_TIME))
+    #error "NEOPIXEL_DEFERRED_SHOW requires NEOPIXEL_SHOW_INTERVAL and NEOPIXEL_FADE_TIME."
   #endif
 #endif
 #undef _RGB_TEST
@@ -2842,6 +2928,13 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
     static_assert(!backlash_arr[CORE_AXIS_1] && !backlash_arr[CORE_AXIS_2],
                   "BACKLASH_COMPENSATION can only apply to " STRINGIFY(NORMAL_AXIS) " with your CORE system.");
   #endif
+  #if ENABLED(BACKLASH_TAKEUP_MOVE)
+    #ifdef BACKLASH_SMOOTHING_MM
+      #error "BACKLASH_TAKEUP_MOVE is not compatible with BACKLASH_SMOOTHING_MM."
+    #elif IS_KINEMATIC
+      #error "BACKLASH_TAKEUP_MOVE is not compatible with DELTA or SCARA."
+    #endif
+  #endif
 #endif
 
 #if ENABLED(GRADIENT_MIX) && MIXING_VIRTUAL_TOOLS < 2
@@ -2865,6 +2958,18 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #endif
 #endif
 
+/**
+ * Fast grid probing requirements
+ */
+#if ENABLED(FAST_GRID_PROBING)
+  #if NONE(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR) || !HAS_BED_PROBE
+    #error "FAST_GRID_PROBING requires AUTO_BED_LEVELING_LINEAR or AUTO_BED_LEVELING_BILINEAR with a bed probe."
+  #elif !defined(FAST_GRID_PROBING_MARGIN)
+    #error "FAST_GRID_PROBING requires FAST_GRID_PROBING_MARGIN."
+  #endif
+  static_assert(FAST_GRID_PROBING_MARGIN > 0, "FAST_GRID_PROBING_MARGIN must be greater than 0.");
+#endif
+
 /**
  * Prusa MMU2 requirements
  */
@@ -2877,6 +2982,8 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
     #error "PRUSA_MMU2_S_MODE or MMU_EXTRUDER_SENSOR requires FILAMENT_RUNOUT_SENSOR. Enable it to continue."
   #elif BOTH(PRUSA_MMU2_S_MODE, MMU_EXTRUDER_SENSOR)
     #error "Enable only one of PRUSA_MMU2_S_MODE or MMU_EXTRUDER_SENSOR."
+  #elif ENABLED(MMU2_ASYNC_TOOL_CHANGE) && EITHER(PRUSA_MMU2_S_MODE, MMU_EXTRUDER_SENSOR)
+    #error "MMU2_ASYNC_TOOL_CHANGE is not compatible with PRUSA_MMU2_S_MODE or MMU_EXTRUDER_SENSOR."
   #elif DISABLED(ADVANCED_PAUSE_FEATURE)
     static_assert(nullptr == strstr(MMU2_FILAMENT_RUNOUT_SCRIPT, "M600"), "ADVANCED_PAUSE_FEATURE is required to use M600 with PRUSA_MMU2.");
   #endif
@@ -2892,7 +2999,11 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
     #error "Both SERVICE_NAME_2 and SERVICE_INTERVAL_2 are required."
   #elif defined(SERVICE_INTERVAL_3) != defined(SERVICE_NAME_3)
     #error "Both SERVICE_NAME_3 and SERVICE_INTERVAL_3 are required."
+  #elif ENABLED(PRINTCOUNTER_JOB_LOG) && DISABLED(SDSUPPORT)
+    #error "PRINTCOUNTER_JOB_LOG requires SDSUPPORT."
   #endif
+#elif ENABLED(PRINTCOUNTER_JOB_LOG)
+  #error "PRINTCOUNTER_JOB_LOG requires PRINTCOUNTER."
 #endif
 
 /**
@@ -2948,6 +3059,15 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
       //  #warning "Enabling LASER_POWER_INLINE_INVERT means that `M5` won't kill the laser immediately; use `M5 I` instead."
       //#endif
     #endif
+    #if ENABLED(LASER_RASTER)
+      #if DISABLED(LASER_FEATURE) || DISABLED(SPINDLE_LASER_PWM)
+        #error "LASER_RASTER requires LASER_FEATURE and SPINDLE_LASER_PWM."
+      #elif IS_KINEMATIC
+        #error "LASER_RASTER is not compatible with DELTA or SCARA."
+      #elif !WITHIN(LASER_RASTER_MAX_PIXELS, 1, 255)
+        #error "LASER_RASTER_MAX_PIXELS must be between 1 and 255."
+      #endif
+    #endif
   #else
     #if SPINDLE_LASER_POWERUP_DELAY < 1
       #error "SPINDLE_LASER_POWERUP_DELAY must be greater than 0."
@@ -2955,7 +3075,7 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
       #error "SPINDLE_LASER_POWERDOWN_DELAY must be greater than 0."
     #elif ENABLED(LASER_MOVE_POWER)
       #error "LASER_MOVE_POWER requires LASER_POWER_INLINE."
-    #elif ANY(LASER_POWER_INLINE_TRAPEZOID, LASER_POWER_INLINE_INVERT, LASER_MOVE_G0_OFF, LASER_MOVE_POWER)
+    #elif ANY(LASER_POWER_INLINE_TRAPEZOID, LASER_POWER_INLINE_INVERT, LASER_MOVE_G0_OFF, LASER_MOVE_POWER, LASER_RASTER)
       #error "Enabled an inline laser feature without inline laser power being enabled."
     #endif
   #endif
@@ -3060,6 +3180,18 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "DIRECT_STEPPING is incompatible with LIN_ADVANCE. Enable in external planner if possible."
 #endif
 
+/**
+ * G1 Move Coalescing
+ */
+#if ENABLED(G1_MOVE_COALESCING)
+  #if ENABLED(NANODLP_Z_SYNC)
+    #error "G1_MOVE_COALESCING is incompatible with NANODLP_Z_SYNC."
+  #elif !defined(COALESCE_MAX_DEVIATION)
+    #error "G1_MOVE_COALESCING requires COALESCE_MAX_DEVIATION."
+  #endif
+  static_assert(COALESCE_MAX_DEVIATION > 0, "COALESCE_MAX_DEVIATION must be greater than 0.");
+#endif
+
 /**
  * Touch Buttons
  */
@@ -3096,5 +3228,16 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #endif
 #endif
 
+/**
+ * Stepper ISR trace
+ */
+#if ENABLED(STEPPER_TRACE)
+  #ifndef STEPPER_TRACE_SIZE
+    #error "STEPPER_TRACE requires STEPPER_TRACE_SIZE."
+  #elif STEPPER_TRACE_SIZE < 16 || STEPPER_TRACE_SIZE > 4096 || (STEPPER_TRACE_SIZE & (STEPPER_TRACE_SIZE - 1))
+    #error "STEPPER_TRACE_SIZE must be a power of 2 from 16 to 4096."
+  #endif
+#endif
+
 // Misc. Cleanup
 #undef _TEST_PWM
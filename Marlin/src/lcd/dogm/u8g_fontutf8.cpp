@@ -54,23 +54,47 @@ typedef struct _font_group_t {
   int m_fntinfo_num;
 } font_group_t;
 
+/**
+ * Cache of recent glyph lookups, indexed by a hash of the codepoint.
+ * Each screen is drawn in several page passes, so the same glyphs are
+ * looked up over and over. A hit skips the search in PROGMEM.
+ */
+#ifndef FONTGROUP_CACHE_SIZE
+  #define FONTGROUP_CACHE_SIZE 16
+#endif
+static_assert(!(FONTGROUP_CACHE_SIZE & (FONTGROUP_CACHE_SIZE - 1)), "FONTGROUP_CACHE_SIZE must be a power of 2.");
+
+typedef struct _fontgroup_cache_t {
+  wchar_t val;          // Codepoint, or 0 for an empty entry
+  const font_t *fnt;    // Font holding the glyph, or nullptr for none
+} fontgroup_cache_t;
+
+static fontgroup_cache_t fontgroup_cache[FONTGROUP_CACHE_SIZE];
+
 static int fontgroup_init(font_group_t * root, const uxg_fontinfo_t * fntinfo, int number) {
   root->m_fntifo = fntinfo;
   root->m_fntinfo_num = number;
+  memset(fontgroup_cache, 0, sizeof(fontgroup_cache));
   return 0;
 }
 
 static const font_t* fontgroup_find(font_group_t * root, wchar_t val) {
-  uxg_fontinfo_t vcmp = {(uint16_t)(val / 128), (uint8_t)(val % 128 + 128), (uint8_t)(val % 128 + 128), 0, 0};
-  size_t idx = 0;
-
   if (val < 256) return nullptr;
 
-  if (pf_bsearch_r((void*)root->m_fntifo, root->m_fntinfo_num, pf_bsearch_cb_comp_fntifo_pgm, (void*)&vcmp, &idx) < 0)
-    return nullptr;
+  fontgroup_cache_t &slot = fontgroup_cache[(val ^ (val >> 5)) & (FONTGROUP_CACHE_SIZE - 1)];
+  if (slot.val == val) return slot.fnt;
+
+  uxg_fontinfo_t vcmp = {(uint16_t)(val / 128), (uint8_t)(val % 128 + 128), (uint8_t)(val % 128 + 128), 0, 0};
+  size_t idx = 0;
+  const font_t *fnt = nullptr;
+  if (pf_bsearch_r((void*)root->m_fntifo, root->m_fntinfo_num, pf_bsearch_cb_comp_fntifo_pgm, (void*)&vcmp, &idx) >= 0) {
+    memcpy_P(&vcmp, root->m_fntifo + idx, sizeof(vcmp));
+    fnt = vcmp.fntdata;
+  }
 
-  memcpy_P(&vcmp, root->m_fntifo + idx, sizeof(vcmp));
-  return vcmp.fntdata;
+  slot.val = val;
+  slot.fnt = fnt;
+  return fnt;
 }
 
 static void fontgroup_drawwchar(font_group_t *group, const font_t *fnt_default, wchar_t val, void * userdata, fontgroup_cb_draw_t cb_draw_ram) {
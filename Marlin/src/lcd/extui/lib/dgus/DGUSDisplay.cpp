@@ -63,6 +63,7 @@ constexpr uint8_t DGUS_CMD_READVAR = 0x83;
 
 void DGUSDisplay::InitDisplay() {
   dgusserial.begin(DGUS_BAUDRATE);
+  InvalidateAllVPs();
 
   if (true
     #if ENABLED(POWER_LOSS_RECOVERY)
@@ -78,19 +79,95 @@ void DGUSDisplay::InitDisplay() {
     );
 }
 
-void DGUSDisplay::WriteVariable(uint16_t adr, const void* values, uint8_t valueslen, bool isstr) {
-  const char* myvalues = static_cast<const char*>(values);
-  bool strend = !myvalues;
-  WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
-    char x;
-    if (!strend) x = *myvalues++;
-    if ((isstr && !x) || strend) {
-      strend = true;
-      x = ' ';
+// VPs below this address are display registers (e.g., page switching), never cached.
+constexpr uint16_t DGUS_VP_CACHE_MIN_ADR = 0x1000;
+
+#if DGUS_VP_CACHE_SIZE
+  // Payload last sent to each numeric VP, so unchanged values can be skipped
+  struct dgus_vp_shadow_t { uint16_t vp; uint8_t len; char data[4]; };
+  static dgus_vp_shadow_t vp_shadow[DGUS_VP_CACHE_SIZE];
+#endif
+
+// Next byte of a payload as sent on the wire. Strings are padded with spaces.
+static char payload_byte(const char* &p, bool &strend, const bool isstr, const bool pgm) {
+  char x = ' ';
+  if (!strend) {
+    x = pgm ? pgm_read_byte(p) : *p;
+    p++;
+    if (isstr && !x) { strend = true; x = ' '; }
+  }
+  return x;
+}
+
+void DGUSDisplay::Write(uint16_t adr, const void* values, uint8_t valueslen, const bool isstr, const bool pgm) {
+  const char *myvalues = static_cast<const char*>(values);
+  bool strend;
+
+  #if DGUS_VP_CACHE_SIZE
+    // Skip the write if the display already holds this value. Longer payloads (strings) are always sent.
+    if (adr >= DGUS_VP_CACHE_MIN_ADR) {
+      dgus_vp_shadow_t &sh = vp_shadow[adr % (DGUS_VP_CACHE_SIZE)];
+      if (valueslen <= sizeof(sh.data)) {
+        char data[sizeof(sh.data)];
+        const char *p = myvalues;
+        strend = !p;
+        for (uint8_t i = 0; i < valueslen; i++) data[i] = payload_byte(p, strend, isstr, pgm);
+        if (sh.vp == adr && sh.len == valueslen && !memcmp(sh.data, data, valueslen)) return;
+        sh.vp = adr; sh.len = valueslen;
+        memcpy(sh.data, data, valueslen);
+      }
+      else if (sh.vp == adr)
+        sh.vp = 0;
     }
-    dgusserial.write(x);
+  #endif
+
+  // Append to the pending frame if this VP directly follows its last word
+  const bool append = tx_frame_len && !(tx_frame_len & 1)
+                   && adr == tx_frame_adr + tx_frame_len / 2
+                   && tx_frame_len + valueslen <= TX_FRAME_MAX;
+  strend = !myvalues;
+  if (!append) {
+    FlushTx();
+    tx_count += 6;
+    if (valueslen > TX_FRAME_MAX) {
+      // Too large to coalesce, so send it right away
+      WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
+      tx_count += valueslen;
+      while (valueslen--) dgusserial.write(payload_byte(myvalues, strend, isstr, pgm));
+      return;
+    }
+    tx_frame_adr = adr;
   }
+  tx_count += valueslen;
+  while (valueslen--) tx_frame[tx_frame_len++] = payload_byte(myvalues, strend, isstr, pgm);
+}
+
+bool DGUSDisplay::FlushTx(const bool nonblocking/*=false*/) {
+  if (!tx_frame_len) return true;
+  if (nonblocking && DGUS_SERIAL_GET_TX_BUFFER_FREE() < 6U + tx_frame_len) return false;
+  WriteHeader(tx_frame_adr, DGUS_CMD_WRITEVAR, tx_frame_len);
+  for (uint8_t i = 0; i < tx_frame_len; i++) dgusserial.write(tx_frame[i]);
+  tx_frame_len = 0;
+  return true;
+}
+
+void DGUSDisplay::InvalidateVP(const uint16_t adr) {
+  #if DGUS_VP_CACHE_SIZE
+    dgus_vp_shadow_t &sh = vp_shadow[adr % (DGUS_VP_CACHE_SIZE)];
+    if (sh.vp == adr) sh.vp = 0;
+  #else
+    UNUSED(adr);
+  #endif
+}
+
+void DGUSDisplay::InvalidateAllVPs() {
+  #if DGUS_VP_CACHE_SIZE
+    LOOP_L_N(i, DGUS_VP_CACHE_SIZE) vp_shadow[i].vp = 0;
+  #endif
+}
+
+void DGUSDisplay::WriteVariable(uint16_t adr, const void* values, uint8_t valueslen, bool isstr) {
+  Write(adr, values, valueslen, isstr, false);
 }
 
 void DGUSDisplay::WriteVariable(uint16_t adr, uint16_t value) {
@@ -123,18 +200,7 @@ void DGUSDisplay::WriteVariable(uint16_t adr, long value) {
 }
 
 void DGUSDisplay::WriteVariablePGM(uint16_t adr, const void* values, uint8_t valueslen, bool isstr) {
-  const char* myvalues = static_cast<const char*>(values);
-  bool strend = !myvalues;
-  WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
-    char x;
-    if (!strend) x = pgm_read_byte(myvalues++);
-    if ((isstr && !x) || strend) {
-      strend = true;
-      x = ' ';
-    }
-    dgusserial.write(x);
-  }
+  Write(adr, values, valueslen, isstr, true);
 }
 
 void DGUSDisplay::ProcessRx() {
@@ -177,7 +243,10 @@ void DGUSDisplay::ProcessRx() {
       case DGUS_WAIT_TELEGRAM: // wait for complete datagram to arrive.
         if (dgusserial.available() < rx_datagram_len) return;
 
-        Initialized = true; // We've talked to it, so we defined it as initialized.
+        if (!Initialized) {
+          Initialized = true; // We've talked to it, so we defined it as initialized.
+          InvalidateAllVPs(); // It may have been (re)started after values were sent
+        }
         uint8_t command = dgusserial.read();
 
         DEBUG_ECHOPAIR("# ", command);
@@ -207,6 +276,7 @@ void DGUSDisplay::ProcessRx() {
         |           Command          DataLen (in Words) */
         if (command == DGUS_CMD_READVAR) {
           const uint16_t vp = tmp[0] << 8 | tmp[1];
+          InvalidateVP(vp);   // The display may now hold a value we didn't send
           //const uint8_t dlen = tmp[2] << 1;  // Convert to Bytes. (Display works with words)
           //DEBUG_ECHOPAIR(" vp=", vp, " dlen=", dlen);
           DGUS_VP_Variable ramcopy;
@@ -229,7 +299,11 @@ void DGUSDisplay::ProcessRx() {
   }
 }
 
-size_t DGUSDisplay::GetFreeTxBuffer() { return DGUS_SERIAL_GET_TX_BUFFER_FREE(); }
+size_t DGUSDisplay::GetFreeTxBuffer() {
+  const size_t txfree = DGUS_SERIAL_GET_TX_BUFFER_FREE(),
+               queued = tx_frame_len ? 6U + tx_frame_len : 0U;
+  return txfree > queued ? txfree - queued : 0;
+}
 
 void DGUSDisplay::WriteHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen) {
   dgusserial.write(DGUS_HEADER1);
@@ -249,6 +323,7 @@ void DGUSDisplay::loop() {
   if (!no_reentrance) {
     no_reentrance = true;
     ProcessRx();
+    FlushTx(true);
     no_reentrance = false;
   }
 }
@@ -257,6 +332,10 @@ rx_datagram_state_t DGUSDisplay::rx_datagram_state = DGUS_IDLE;
 uint8_t DGUSDisplay::rx_datagram_len = 0;
 bool DGUSDisplay::Initialized = false;
 bool DGUSDisplay::no_reentrance = false;
+uint8_t DGUSDisplay::tx_frame[TX_FRAME_MAX];
+uint8_t DGUSDisplay::tx_frame_len = 0;
+uint16_t DGUSDisplay::tx_frame_adr = 0;
+uint16_t DGUSDisplay::tx_count = 0;
 
 // A SW memory barrier, to ensure GCC does not overoptimize loops
 #define sw_barrier() asm volatile("": : :"memory");
@@ -33,6 +33,13 @@
 
 enum DGUSLCD_Screens : uint8_t;
 
+#ifndef DGUS_VP_CACHE_SIZE
+  #define DGUS_VP_CACHE_SIZE 32
+#endif
+#ifndef DGUS_UPDATE_TX_BUDGET
+  #define DGUS_UPDATE_TX_BUDGET 96
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_DGUSLCD)
 #include "../../../../core/debug_out.h"
 
@@ -83,15 +90,29 @@ public:
   // Periodic tasks, eg. Rx-Queue handling.
   static void loop();
 
+  // Send the coalesced frame. If nonblocking, only when it fits in the Tx buffer.
+  static bool FlushTx(const bool nonblocking=false);
+  static inline bool TxPending() { return tx_frame_len; }
+
+  // Forget the value last sent to a VP, e.g. because the display changed it.
+  static void InvalidateVP(const uint16_t adr);
+
+  // Forget all values sent, e.g. because the display was (re)started.
+  static void InvalidateAllVPs();
+
 public:
   // Helper for users of this class to estimate if an interaction would be blocking.
   static size_t GetFreeTxBuffer();
 
+  // Running count of bytes queued for the display, to budget screen updates.
+  static inline uint16_t GetTxCount() { return tx_count; }
+
   // Checks two things: Can we confirm the presence of the display and has we initiliazed it.
   // (both boils down that the display answered to our chatting)
   static inline bool isInitialized() { return Initialized; }
 
 private:
+  static void Write(uint16_t adr, const void* values, uint8_t valueslen, const bool isstr, const bool pgm);
   static void WriteHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen);
   static void WritePGM(const char str[], uint8_t len);
   static void ProcessRx();
@@ -100,6 +121,11 @@ private:
   static rx_datagram_state_t rx_datagram_state;
   static uint8_t rx_datagram_len;
   static bool Initialized, no_reentrance;
+
+  // Consecutive VP writes are coalesced into a single frame
+  static constexpr uint8_t TX_FRAME_MAX = DGUS_TX_BUFFER_SIZE - 6;  // Payload that fits in the Tx buffer with its header
+  static uint8_t tx_frame[TX_FRAME_MAX], tx_frame_len;
+  static uint16_t tx_frame_adr, tx_count;
 };
 
 #define GET_VARIABLE(f, t, V...) (&DGUSDisplay::GetVariable<decltype(t), f, t, ##V>)
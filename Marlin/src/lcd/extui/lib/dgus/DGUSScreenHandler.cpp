@@ -1068,6 +1068,9 @@ void DGUSScreenHandler::UpdateScreenVPData() {
   // Round-robin updating of all VPs.
   VPList += update_ptr;
 
+  // Unchanged VPs aren't sent, so only count bytes actually queued
+  const uint16_t tx_start = dgusdisplay.GetTxCount();
+
   bool sent_one = false;
   do {
     uint16_t VP = pgm_read_word(VPList);
@@ -1086,7 +1089,8 @@ void DGUSScreenHandler::UpdateScreenVPData() {
       uint8_t expected_tx = 6 + rcpy.size;  // expected overhead is 6 bytes + payload.
       // Send the VP to the display, but try to avoid overrunning the Tx Buffer.
       // But send at least one VP, to avoid getting stalled.
-      if (rcpy.send_to_display_handler && (!sent_one || expected_tx <= dgusdisplay.GetFreeTxBuffer())) {
+      const bool in_budget = uint16_t(dgusdisplay.GetTxCount() - tx_start) < DGUS_UPDATE_TX_BUDGET;
+      if (rcpy.send_to_display_handler && (!sent_one || (in_budget && expected_tx <= dgusdisplay.GetFreeTxBuffer()))) {
         //DEBUG_ECHOPAIR(" calling handler for ", rcpy.VP);
         sent_one = true;
         rcpy.send_to_display_handler(rcpy);
@@ -1117,6 +1121,7 @@ bool DGUSScreenHandler::loop() {
   if (!IsScreenComplete() || ELAPSED(ms, next_event_ms)) {
     next_event_ms = ms + DGUS_UPDATE_INTERVAL_MS;
     UpdateScreenVPData();
+    dgusdisplay.FlushTx(true);
   }
 
   #if ENABLED(SHOW_BOOTSCREEN)
@@ -1128,7 +1133,7 @@ bool DGUSScreenHandler::loop() {
       GotoScreen(DGUSLCD_SCREEN_MAIN);
     }
   #endif
-  return IsScreenComplete();
+  return IsScreenComplete() && !dgusdisplay.TxPending();
 }
 
 void DGUSDisplay::RequestScreen(DGUSLCD_Screens screen) {
@@ -439,6 +439,48 @@ char *creat_title_text() {
 
   uint32_t gPicturePreviewStart = 0;
 
+  #if HAS_BAK_VIEW_IN_FLASH
+
+    // The decoded preview stays in the BAK view area. A small tag after the image
+    // records which file it came from, so starting the same job again draws the
+    // preview straight from SPI flash instead of decoding the SD file again.
+    #define PREVIEW_CACHE_MAGIC 0x5650534DUL // "MSPV"
+    #define PREVIEW_CACHE_ADDR  (BAK_VIEW_ADDR_TFT35 + FLASH_VIEW_MAX_SIZE)
+
+    typedef struct {
+      uint32_t magic, filesize, namehash;
+      uint16_t lastWriteDate, lastWriteTime; // A file rewritten under the same name and size is a miss
+    } preview_cache_t;
+    static_assert(FLASH_VIEW_MAX_SIZE + sizeof(preview_cache_t) <= 80 * 1024UL, "Preview cache tag doesn't fit in the BAK view area.");
+
+    static preview_cache_t preview_key;
+
+    static uint32_t preview_name_hash(const char *path) {
+      uint32_t h = 2166136261UL; // FNV-1a
+      while (*path) { h ^= (uint8_t)*path++; h *= 16777619UL; }
+      return h;
+    }
+
+    static bool preview_cache_hit() {
+      preview_cache_t stored;
+      W25QXX.init(SPI_QUARTER_SPEED);
+      W25QXX.SPI_FLASH_BufferRead((uint8_t*)&stored, PREVIEW_CACHE_ADDR, sizeof(stored));
+      return !memcmp(&stored, &preview_key, sizeof(stored));
+    }
+
+    // Clearing bits needs no erase, so the tag is dropped before the image is overwritten
+    static void preview_cache_invalidate() {
+      uint32_t zero = 0;
+      W25QXX.SPI_FLASH_BufferWrite((uint8_t*)&zero, PREVIEW_CACHE_ADDR, sizeof(zero));
+    }
+
+    static void preview_cache_store() {
+      W25QXX.init(SPI_QUARTER_SPEED);
+      W25QXX.SPI_FLASH_BufferWrite((uint8_t*)&preview_key, PREVIEW_CACHE_ADDR, sizeof(preview_key));
+    }
+
+  #endif // HAS_BAK_VIEW_IN_FLASH
+
   void preview_gcode_prehandle(char *path) {
     #if ENABLED(SDSUPPORT)
       //uint8_t re;
@@ -457,8 +499,23 @@ char *creat_title_text() {
         pre_read_cnt = (uint32_t)p1 - (uint32_t)((uint32_t *)(&public_buf[0]));
 
         To_pre_view              = pre_read_cnt;
-        gcode_preview_over       = 1;
         gCfgItems.from_flash_pic = 1;
+        #if HAS_BAK_VIEW_IN_FLASH
+          preview_key.magic    = PREVIEW_CACHE_MAGIC;
+          preview_key.filesize = card.getFileSize();
+          preview_key.namehash = preview_name_hash(path);
+          dir_t entry;
+          const bool dated = card.getFileDirEntry(entry);
+          preview_key.lastWriteDate = dated ? entry.lastWriteDate : 0;
+          preview_key.lastWriteTime = dated ? entry.lastWriteTime : 0;
+          if (dated && preview_cache_hit()) {
+            // Already decoded: start printing now and stream the image from flash
+            gcode_preview_over  = 0;
+            flash_preview_begin = 1;
+          }
+          else
+        #endif
+            gcode_preview_over = 1;
         update_spi_flash();
       }
       else {
@@ -535,6 +592,7 @@ char *creat_title_text() {
         #endif
         #if HAS_BAK_VIEW_IN_FLASH
           W25QXX.init(SPI_QUARTER_SPEED);
+          if (row == 0) preview_cache_invalidate();
           if (row < 20) W25QXX.SPI_FLASH_SectorErase(BAK_VIEW_ADDR_TFT35 + row * 4096);
           W25QXX.SPI_FLASH_BufferWrite(bmp_public_buf, BAK_VIEW_ADDR_TFT35 + row * 400, 400);
         #endif
@@ -543,6 +601,10 @@ char *creat_title_text() {
           size = 809;
           row  = 0;
 
+          #if HAS_BAK_VIEW_IN_FLASH
+            preview_cache_store();
+          #endif
+
           gcode_preview_over = 0;
           //flash_preview_begin = 1;
 
@@ -731,61 +793,73 @@ char *creat_title_text() {
 
   #endif // if 1
 
-  void Draw_default_preview(int xpos_pixel, int ypos_pixel, uint8_t sel) {
-    int index;
-    int y_off = 0;
-
-    for (index = 0; index < 10; index++) { // 200*200
-      #if HAS_BAK_VIEW_IN_FLASH
-        if (sel == 1) {
-          flash_view_Read(bmp_public_buf, 8000); // 20k
-        }
-        else {
-          default_view_Read(bmp_public_buf, DEFAULT_VIEW_MAX_SIZE / 10); // 20k
-        }
-      #else
+  // Draw one 200x20 band of the stored preview (sel 1) or the default image (sel 0)
+  static void draw_preview_band(int xpos_pixel, int ypos_pixel, uint8_t sel, int y_off) {
+    #if HAS_BAK_VIEW_IN_FLASH
+      if (sel == 1) {
+        W25QXX.init(SPI_QUARTER_SPEED);
+        W25QXX.SPI_FLASH_BufferRead(bmp_public_buf, BAK_VIEW_ADDR_TFT35 + y_off * 8000, 8000); // 20k
+      }
+      else {
         default_view_Read(bmp_public_buf, DEFAULT_VIEW_MAX_SIZE / 10); // 20k
-      #endif
+      }
+    #else
+      default_view_Read(bmp_public_buf, DEFAULT_VIEW_MAX_SIZE / 10); // 20k
+    #endif
 
-      #if ENABLED(TFT_LVGL_UI_SPI)
-        SPI_TFT.SetWindows(xpos_pixel, y_off * 20 + ypos_pixel, 200, 20); // 200*200
-        SPI_TFT.tftio.WriteSequence((uint16_t*)(bmp_public_buf), DEFAULT_VIEW_MAX_SIZE / 20);
-      #else
-        int x_off = 0;
-        uint16_t temp_p;
-        int i = 0;
-        uint16_t *p_index;
-        ili9320_SetWindows(xpos_pixel, y_off * 20 + ypos_pixel, 200, 20); // 200*200
-
-        LCD_WriteRAM_Prepare();
-
-        for (int _y = y_off * 20; _y < (y_off + 1) * 20; _y++) {
-          for (x_off = 0; x_off < 200; x_off++) {
-            if (sel == 1) {
-              temp_p  = (uint16_t)(bmp_public_buf[i] | bmp_public_buf[i + 1] << 8);
-              p_index = &temp_p;
-            }
-            else {
-              p_index = (uint16_t *)(&bmp_public_buf[i]);
-            }
-            if (*p_index == 0x0000) *p_index = LV_COLOR_BACKGROUND.full; //gCfgItems.preview_bk_color;
-            LCD_IO_WriteData(*p_index);
-            i += 2;
+    #if ENABLED(TFT_LVGL_UI_SPI)
+      SPI_TFT.SetWindows(xpos_pixel, y_off * 20 + ypos_pixel, 200, 20); // 200*200
+      SPI_TFT.tftio.WriteSequence((uint16_t*)(bmp_public_buf), DEFAULT_VIEW_MAX_SIZE / 20);
+    #else
+      int x_off = 0;
+      uint16_t temp_p;
+      int i = 0;
+      uint16_t *p_index;
+      ili9320_SetWindows(xpos_pixel, y_off * 20 + ypos_pixel, 200, 20); // 200*200
+
+      LCD_WriteRAM_Prepare();
+
+      for (int _y = y_off * 20; _y < (y_off + 1) * 20; _y++) {
+        for (x_off = 0; x_off < 200; x_off++) {
+          if (sel == 1) {
+            temp_p  = (uint16_t)(bmp_public_buf[i] | bmp_public_buf[i + 1] << 8);
+            p_index = &temp_p;
           }
-          if (i >= 8000) break;
+          else {
+            p_index = (uint16_t *)(&bmp_public_buf[i]);
+          }
+          if (*p_index == 0x0000) *p_index = LV_COLOR_BACKGROUND.full; //gCfgItems.preview_bk_color;
+          LCD_IO_WriteData(*p_index);
+          i += 2;
         }
-      #endif // TFT_LVGL_UI_SPI
-      y_off++;
-    }
+        if (i >= 8000) break;
+      }
+    #endif // TFT_LVGL_UI_SPI
+  }
+
+  void Draw_default_preview(int xpos_pixel, int ypos_pixel, uint8_t sel) {
+    for (int y_off = 0; y_off < 10; y_off++) // 200*200
+      draw_preview_band(xpos_pixel, ypos_pixel, sel, y_off);
     W25QXX.init(SPI_QUARTER_SPEED);
   }
 
   void disp_pre_gcode(int xpos_pixel, int ypos_pixel) {
     if (gcode_preview_over == 1) gcode_preview(list_file.file_name[sel_id], xpos_pixel, ypos_pixel);
     #if HAS_BAK_VIEW_IN_FLASH
+      // Stream the stored preview one band per call so the UI and planner keep running
+      static uint8_t preview_band;
       if (flash_preview_begin == 1) {
-        flash_preview_begin = 0;
-        Draw_default_preview(xpos_pixel, ypos_pixel, 1);
+        flash_preview_begin = 2;
+        preview_band = 0;
+      }
+      if (flash_preview_begin == 2) {
+        if (disp_state != PRINTING_UI)
+          flash_preview_begin = 0;
+        else {
+          draw_preview_band(xpos_pixel, ypos_pixel, 1, preview_band);
+          W25QXX.init(SPI_QUARTER_SPEED);
+          if (++preview_band >= 10) flash_preview_begin = 0;
+        }
       }
     #endif
     #if HAS_GCODE_DEFAULT_VIEW_IN_FLASH
@@ -544,6 +544,7 @@ namespace Language_en {
   PROGMEM Language_Str MSG_MMU2_MENU                       = _UxGT("MMU");
   PROGMEM Language_Str MSG_KILL_MMU2_FIRMWARE              = _UxGT("Update MMU Firmware!");
   PROGMEM Language_Str MSG_MMU2_NOT_RESPONDING             = _UxGT("MMU Needs Attention.");
+  PROGMEM Language_Str MSG_MMU2_BUSY                       = _UxGT("MMU Busy. Try later.");
   PROGMEM Language_Str MSG_MMU2_RESUME                     = _UxGT("MMU Resume");
   PROGMEM Language_Str MSG_MMU2_RESUMING                   = _UxGT("MMU Resuming...");
   PROGMEM Language_Str MSG_MMU2_LOAD_FILAMENT              = _UxGT("MMU Load");
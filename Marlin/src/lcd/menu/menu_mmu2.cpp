@@ -28,14 +28,30 @@
 #include "menu_mmu2.h"
 #include "menu.h"
 
+#if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+  #include "../../libs/buzzer.h"
+#endif
+
 uint8_t currentTool;
 bool mmuMenuWait;
 
+#if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+  // Menu actions run from idle(), maybe while a T command is still
+  // changing filament. Refuse to talk to the MMU until it's done.
+  static bool mmu2_busy() {
+    if (!mmu2.tool_change_pending()) return false;
+    BUZZ(200, 404);
+    LCD_ALERTMESSAGEPGM(MSG_MMU2_BUSY);
+    return true;
+  }
+#endif
+
 //
 // Load Filament
 //
 
 void _mmu2_load_filamentToNozzle(uint8_t index) {
+  if (TERN0(MMU2_ASYNC_TOOL_CHANGE, mmu2_busy())) return;
   ui.reset_status();
   ui.return_to_status();
   ui.status_printf_P(0,  GET_TEXT(MSG_MMU2_LOADING_FILAMENT), int(index + 1));
@@ -48,12 +64,14 @@ inline void action_mmu2_load_filament_to_nozzle(const uint8_t tool) {
 }
 
 void _mmu2_load_filament(uint8_t index) {
+  if (TERN0(MMU2_ASYNC_TOOL_CHANGE, mmu2_busy())) return;
   ui.return_to_status();
   ui.status_printf_P(0, GET_TEXT(MSG_MMU2_LOADING_FILAMENT), int(index + 1));
   mmu2.load_filament(index);
   ui.reset_status();
 }
 void action_mmu2_load_all() {
+  if (TERN0(MMU2_ASYNC_TOOL_CHANGE, mmu2_busy())) return;
   LOOP_L_N(i, EXTRUDERS) _mmu2_load_filament(i);
   ui.return_to_status();
 }
@@ -78,6 +96,7 @@ void menu_mmu2_load_to_nozzle() {
 //
 
 void _mmu2_eject_filament(uint8_t index) {
+  if (TERN0(MMU2_ASYNC_TOOL_CHANGE, mmu2_busy())) return;
   ui.reset_status();
   ui.return_to_status();
   ui.status_printf_P(0, GET_TEXT(MSG_MMU2_EJECTING_FILAMENT), int(index + 1));
@@ -85,6 +104,7 @@ void _mmu2_eject_filament(uint8_t index) {
 }
 
 void action_mmu2_unload_filament() {
+  if (TERN0(MMU2_ASYNC_TOOL_CHANGE, mmu2_busy())) return;
   ui.reset_status();
   ui.return_to_status();
   LCD_MESSAGEPGM(MSG_MMU2_UNLOADING_FILAMENT);
@@ -104,6 +124,7 @@ void menu_mmu2_eject_filament() {
 //
 
 void action_mmu2_reset() {
+  if (TERN0(MMU2_ASYNC_TOOL_CHANGE, mmu2_busy())) return;
   mmu2.init();
   ui.reset_status();
 }
@@ -628,6 +628,7 @@ void MarlinUI::kill_screen(PGM_P lcd_error, PGM_P lcd_component) {
       neo.set_pixel_color(NEOPIXEL_BKGD_LED_INDEX, 255, 0, 0, 0);
       neo.show();
     #endif
+    TERN_(NEOPIXEL_DEFERRED_SHOW, neo.flush());  // No more idle() to send it
   #endif
 
   draw_kill_screen();
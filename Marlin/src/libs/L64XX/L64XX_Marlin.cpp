@@ -144,8 +144,10 @@ void L6470_populate_chain_array() {
  *   3. Copy status layout
  *   4. Make all error bits active low (as needed)
  */
-uint16_t L64XX_Marlin::get_stepper_status(L64XX &st) {
-  shadow.STATUS_AXIS_RAW           = st.getStatus();
+uint16_t L64XX_Marlin::get_stepper_status(L64XX &st) { return get_stepper_status(st, st.getStatus()); }
+
+uint16_t L64XX_Marlin::get_stepper_status(L64XX &st, const uint16_t raw) {
+  shadow.STATUS_AXIS_RAW           = raw;
   shadow.STATUS_AXIS               = shadow.STATUS_AXIS_RAW;
   shadow.STATUS_AXIS_LAYOUT        = st.L6470_status_layout;
   shadow.AXIS_OCD_TH_MAX           = st.OCD_TH_MAX;
@@ -257,6 +259,91 @@ uint16_t L64XX_Marlin::get_status(const L64XX_axis_t axis) {
   return 0; // Not needed but kills a compiler warning
 }
 
+/**
+ * Decode a status already read from the given axis, e.g. by get_all_status()
+ */
+uint16_t L64XX_Marlin::get_status(const L64XX_axis_t axis, const uint16_t raw) {
+
+  #define DECODE_L6470(Q) get_stepper_status(stepper##Q, raw)
+
+  switch (axis) {
+    default: break;
+    #if AXIS_IS_L64XX(X)
+      case X : return DECODE_L6470(X);
+    #endif
+    #if AXIS_IS_L64XX(Y)
+      case Y : return DECODE_L6470(Y);
+    #endif
+    #if AXIS_IS_L64XX(Z)
+      case Z : return DECODE_L6470(Z);
+    #endif
+    #if AXIS_IS_L64XX(X2)
+      case X2: return DECODE_L6470(X2);
+    #endif
+    #if AXIS_IS_L64XX(Y2)
+      case Y2: return DECODE_L6470(Y2);
+    #endif
+    #if AXIS_IS_L64XX(Z2)
+      case Z2: return DECODE_L6470(Z2);
+    #endif
+    #if AXIS_IS_L64XX(Z3)
+      case Z3: return DECODE_L6470(Z3);
+    #endif
+    #if AXIS_IS_L64XX(Z4)
+      case Z4: return DECODE_L6470(Z4);
+    #endif
+    #if AXIS_IS_L64XX(E0)
+      case E0: return DECODE_L6470(E0);
+    #endif
+    #if AXIS_IS_L64XX(E1)
+      case E1: return DECODE_L6470(E1);
+    #endif
+    #if AXIS_IS_L64XX(E2)
+      case E2: return DECODE_L6470(E2);
+    #endif
+    #if AXIS_IS_L64XX(E3)
+      case E3: return DECODE_L6470(E3);
+    #endif
+    #if AXIS_IS_L64XX(E4)
+      case E4: return DECODE_L6470(E4);
+    #endif
+    #if AXIS_IS_L64XX(E5)
+      case E5: return DECODE_L6470(E5);
+    #endif
+    #if AXIS_IS_L64XX(E6)
+      case E6: return DECODE_L6470(E6);
+    #endif
+    #if AXIS_IS_L64XX(E7)
+      case E7: return DECODE_L6470(E7);
+    #endif
+  }
+
+  return 0; // Not needed but kills a compiler warning
+}
+
+/**
+ * Read the status of every driver in the chain with three chain-wide frames
+ * (GET_STATUS then the two reply bytes) instead of three frames per driver.
+ * Raw status registers are stored by axis index. Returns false if aborted.
+ */
+bool L64XX_Marlin::get_all_status(uint16_t raw[MAX_L64XX]) {
+  const uint8_t n = L64XX::chain[0];
+  uint8_t buf[MAX_L64XX + 1];
+
+  for (uint8_t j = 1; j <= n; j++) buf[j] = dSPIN_GET_STATUS;
+  if (!transfer_frame(buf, n)) return false;
+
+  for (uint8_t j = 1; j <= n; j++) buf[j] = dSPIN_NOP;
+  if (!transfer_frame(buf, n)) return false;
+  for (uint8_t j = 1; j <= n; j++) raw[L64XX::chain[j]] = uint16_t(buf[j]) << 8;
+
+  for (uint8_t j = 1; j <= n; j++) buf[j] = dSPIN_NOP;
+  if (!transfer_frame(buf, n)) return false;
+  for (uint8_t j = 1; j <= n; j++) raw[L64XX::chain[j]] |= buf[j];
+
+  return true;
+}
+
 uint32_t L64XX_Marlin::get_param(const L64XX_axis_t axis, const uint8_t param) {
 
   #define GET_L6470_PARAM(Q) L6470_GETPARAM(param, Q)
@@ -752,10 +839,13 @@ void L64XX_Marlin::say_axis(const L64XX_axis_t axis, const uint8_t label/*=true*
     if (err) p += sprintf_P(p, err);
   }
 
-  void L64XX_Marlin::monitor_update(L64XX_axis_t stepper_index) {
+  uint16_t L64XX_Marlin::spi_frames, L64XX_Marlin::spi_bytes,
+           L64XX_Marlin::poll_frames, L64XX_Marlin::poll_bytes;
+
+  void L64XX_Marlin::monitor_update(L64XX_axis_t stepper_index, const uint16_t raw) {
     if (spi_abort) return;  // don't do anything if set_directions() has occurred
     const L64XX_shadow_t &sh = shadow;
-    get_status(stepper_index); // get stepper status and details
+    get_status(stepper_index, raw); // decode stepper status and details
     uint16_t status = sh.STATUS_AXIS;
     uint8_t kval_hold, tval;
     char temp_buf[120], *p = temp_buf;
@@ -880,48 +970,16 @@ void L64XX_Marlin::say_axis(const L64XX_axis_t axis, const uint8_t label/*=true*
 
         spi_active = true;    // Tell set_directions() a series of SPI transfers is underway
 
-        #if AXIS_IS_L64XX(X)
-          monitor_update(X);
-        #endif
-        #if AXIS_IS_L64XX(Y)
-          monitor_update(Y);
-        #endif
-        #if AXIS_IS_L64XX(Z)
-          monitor_update(Z);
-        #endif
-        #if AXIS_IS_L64XX(X2)
-          monitor_update(X2);
-        #endif
-        #if AXIS_IS_L64XX(Y2)
-          monitor_update(Y2);
-        #endif
-        #if AXIS_IS_L64XX(Z2)
-          monitor_update(Z2);
-        #endif
-        #if AXIS_IS_L64XX(Z3)
-          monitor_update(Z3);
-        #endif
-        #if AXIS_IS_L64XX(Z4)
-          monitor_update(Z4);
-        #endif
-        #if AXIS_IS_L64XX(E0)
-          monitor_update(E0);
-        #endif
-        #if AXIS_IS_L64XX(E1)
-          monitor_update(E1);
-        #endif
-        #if AXIS_IS_L64XX(E2)
-          monitor_update(E2);
-        #endif
-        #if AXIS_IS_L64XX(E3)
-          monitor_update(E3);
-        #endif
-        #if AXIS_IS_L64XX(E4)
-          monitor_update(E4);
-        #endif
-        #if AXIS_IS_L64XX(E5)
-          monitor_update(E5);
-        #endif
+        const uint16_t frames = spi_frames, bytes = spi_bytes;
+
+        // Read all drivers at once, then check each one
+        uint16_t raw[MAX_L64XX];
+        if (get_all_status(raw))
+          for (uint8_t j = 1; j <= L64XX::chain[0]; j++)
+            monitor_update(L64XX_axis_t(L64XX::chain[j]), raw[L64XX::chain[j]]);
+
+        poll_frames = spi_frames - frames;
+        poll_bytes = spi_bytes - bytes;
 
         if (TERN0(L6470_DEBUG, report_L6470_status)) DEBUG_EOL();
 
@@ -55,8 +55,12 @@ public:
   static void init_to_defaults();
 
   static uint16_t get_stepper_status(L64XX &st);
+  static uint16_t get_stepper_status(L64XX &st, const uint16_t raw);
 
   static uint16_t get_status(const L64XX_axis_t axis);
+  static uint16_t get_status(const L64XX_axis_t axis, const uint16_t raw);
+
+  static bool get_all_status(uint16_t raw[MAX_L64XX]);
 
   static uint32_t get_param(const L64XX_axis_t axis, const uint8_t param);
 
@@ -69,6 +73,7 @@ public:
                             uint8_t over_current_flag, uint8_t &OCD_TH_val, uint8_t &STALL_TH_val, uint16_t &over_current_threshold);
 
   static void transfer(uint8_t L6470_buf[], const uint8_t length);
+  static bool transfer_frame(uint8_t L6470_buf[], const uint8_t length);
 
   static void say_axis(const L64XX_axis_t axis, const uint8_t label=true);
   #if ENABLED(L6470_CHITCHAT)
@@ -117,8 +122,13 @@ public:
   #if ENABLED(MONITOR_L6470_DRIVER_STATUS)
     static bool monitor_paused;
     static inline void pause_monitor(const bool p) { monitor_paused = p; }
-    static void monitor_update(L64XX_axis_t stepper_index);
+    static void monitor_update(L64XX_axis_t stepper_index, const uint16_t raw);
     static void monitor_driver();
+
+    // SPI chain traffic, reported by M122
+    static uint16_t spi_frames, spi_bytes,    // Running totals
+                    poll_frames, poll_bytes;  // Traffic of the last monitor poll
+    static inline void count_frame(const uint8_t length) { spi_frames++; spi_bytes += length; }
   #else
     static inline void pause_monitor(const bool) {}
   #endif
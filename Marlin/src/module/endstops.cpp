@@ -57,6 +57,10 @@ volatile uint8_t Endstops::hit_state;
 
 Endstops::esbits_t Endstops::live_state = 0;
 
+#if ENABLED(ENDSTOP_POLL_APPROACH_ONLY)
+  volatile bool Endstops::poll_all; // = false
+#endif
+
 #if ENDSTOP_NOISE_THRESHOLD
   Endstops::esbits_t Endstops::validated_live_state;
   uint8_t Endstops::endstop_poll_count;
@@ -331,8 +335,13 @@ void Endstops::not_homing() {
 void Endstops::resync() {
   if (!abort_enabled()) return;     // If endstops/probes are disabled the loop below can hang
 
-  // Wait for Temperature ISR to run at least once (runs at 1KHz)
-  TERN(ENDSTOP_INTERRUPTS_FEATURE, update(), safe_delay(2));
+  #if ENABLED(ENDSTOP_POLL_APPROACH_ONLY)
+    // The ISR may skip switches no move is heading toward, so read them all now
+    refresh();
+  #else
+    // Wait for Temperature ISR to run at least once (runs at 1KHz)
+    TERN(ENDSTOP_INTERRUPTS_FEATURE, update(), safe_delay(2));
+  #endif
   while (TERN0(ENDSTOP_NOISE_THRESHOLD, endstop_poll_count)) safe_delay(1);
 }
 
@@ -488,6 +497,49 @@ void _O2 Endstops::report_states() {
 #define _ENDSTOP_PIN(AXIS, MINMAX) AXIS ##_## MINMAX ##_PIN
 #define _ENDSTOP_INVERTING(AXIS, MINMAX) AXIS ##_## MINMAX ##_ENDSTOP_INVERTING
 
+#if ENABLED(ENDSTOP_POLL_APPROACH_ONLY)
+
+  // The switches the current move is heading toward
+  static Endstops::esbits_t approached_endstops() {
+    #if IS_CORE
+      return Endstops::esbits_t(~0); // Head and motor directions differ. Read them all.
+    #else
+      #define _MIN_BITS(A) (_BV(A##_MIN) | TERN0(A##_DUAL_ENDSTOPS, _BV(A##2_MIN)))
+      #define _MAX_BITS(A) (_BV(A##_MAX) | TERN0(A##_DUAL_ENDSTOPS, _BV(A##2_MAX)))
+      #define _APPROACH(A, MINBITS, MAXBITS) if (stepper.axis_is_moving(_AXIS(A))) bits |= stepper.motor_direction(_AXIS(A)) ? (MINBITS) : (MAXBITS)
+
+      Endstops::esbits_t bits = 0;
+      _APPROACH(X, _MIN_BITS(X), _MAX_BITS(X));
+      _APPROACH(Y, _MIN_BITS(Y), _MAX_BITS(Y));
+      _APPROACH(Z,
+        _BV(Z_MIN) | _BV(Z_MIN_PROBE) | TERN0(Z_MULTI_ENDSTOPS, _BV(Z2_MIN) | _BV(Z3_MIN) | _BV(Z4_MIN)),
+        _BV(Z_MAX) | TERN0(Z_MULTI_ENDSTOPS, _BV(Z2_MAX) | _BV(Z3_MAX) | _BV(Z4_MAX))
+      );
+      #if ENABLED(G38_PROBE_TARGET)
+        if (G38_move) SBI(bits, Z_MIN_PROBE);
+      #endif
+      return bits;
+
+      #undef _MIN_BITS
+      #undef _MAX_BITS
+      #undef _APPROACH
+    #endif
+  }
+
+#endif
+
+#if ENABLED(ENDSTOP_POLL_APPROACH_ONLY)
+
+  // Bits for switches not being approached are left stale by update()
+  Endstops::esbits_t Endstops::refresh() {
+    poll_all = true;
+    update();
+    poll_all = false;
+    return state();
+  }
+
+#endif
+
 // Check endstops - Could be called from Temperature ISR!
 void Endstops::update() {
 
@@ -495,7 +547,15 @@ void Endstops::update() {
     if (!abort_enabled()) return;
   #endif
 
-  #define UPDATE_ENDSTOP_BIT(AXIS, MINMAX) SET_BIT_TO(live_state, _ENDSTOP(AXIS, MINMAX), (READ(_ENDSTOP_PIN(AXIS, MINMAX)) != _ENDSTOP_INVERTING(AXIS, MINMAX)))
+  #if ENABLED(ENDSTOP_POLL_APPROACH_ONLY)
+    const esbits_t watched = poll_all ? esbits_t(~0) : approached_endstops();
+    if (!watched) return;
+    #define _WATCHED(AXIS, MINMAX) TEST(watched, _ENDSTOP(AXIS, MINMAX))
+  #else
+    #define _WATCHED(AXIS, MINMAX) true
+  #endif
+
+  #define UPDATE_ENDSTOP_BIT(AXIS, MINMAX) do{ if (_WATCHED(AXIS, MINMAX)) SET_BIT_TO(live_state, _ENDSTOP(AXIS, MINMAX), (READ(_ENDSTOP_PIN(AXIS, MINMAX)) != _ENDSTOP_INVERTING(AXIS, MINMAX))); }while(0)
   #define COPY_LIVE_STATE(SRC_BIT, DST_BIT) SET_BIT_TO(live_state, DST_BIT, TEST(live_state, SRC_BIT))
 
   #if ENABLED(G38_PROBE_TARGET) && PIN_EXISTS(Z_MIN_PROBE) && !(CORE_IS_XY || CORE_IS_XZ)
@@ -64,6 +64,10 @@ class Endstops {
     static esbits_t live_state;
     static volatile uint8_t hit_state;      // Use X_MIN, Y_MIN, Z_MIN and Z_MIN_PROBE as BIT index
 
+    #if ENABLED(ENDSTOP_POLL_APPROACH_ONLY)
+      static volatile bool poll_all;        // Read every switch in the next update()
+    #endif
+
     #if ENDSTOP_NOISE_THRESHOLD
       static esbits_t validated_live_state;
       static uint8_t endstop_poll_count;    // Countdown from threshold for polling
@@ -98,6 +102,14 @@ class Endstops {
      */
     static void update();
 
+    #if ENABLED(ENDSTOP_POLL_APPROACH_ONLY)
+      /**
+       * Read every switch, including those the current move isn't
+       * heading toward, and return the refreshed state.
+       */
+      static esbits_t refresh();
+    #endif
+
     /**
      * Get Endstop hit state.
      */
@@ -318,11 +318,11 @@ void line_to_current_position(const feedRate_t &fr_mm_s/*=feedrate_mm_s*/) {
 }
 
 #if EXTRUDERS
-  void unscaled_e_move(const float &length, const feedRate_t &fr_mm_s) {
+  void unscaled_e_move(const float &length, const feedRate_t &fr_mm_s, const bool sync/*=true*/) {
     TERN_(HAS_FILAMENT_SENSOR, runout.reset());
     current_position.e += length / planner.e_factor[active_extruder];
     line_to_current_position(fr_mm_s);
-    planner.synchronize();
+    if (sync) planner.synchronize();
   }
 #endif
 
@@ -386,8 +386,7 @@ void _internal_move_to_destination(const feedRate_t &fr_mm_s/*=0.0f*/
 /**
  * Plan a move to (X, Y, Z) and set the current_position
  */
-void do_blocking_move_to(const float rx, const float ry, const float rz, const feedRate_t &fr_mm_s/*=0.0*/) {
-  DEBUG_SECTION(log_move, "do_blocking_move_to", DEBUGGING(LEVELING));
+void do_queued_move_to(const float rx, const float ry, const float rz, const feedRate_t &fr_mm_s/*=0.0*/) {
   if (DEBUGGING(LEVELING)) DEBUG_XYZ("> ", rx, ry, rz);
 
   const feedRate_t z_feedrate = fr_mm_s ?: homing_feedrate(Z_AXIS),
@@ -471,7 +470,14 @@ void do_blocking_move_to(const float rx, const float ry, const float rz, const f
     }
 
   #endif
+}
 
+/**
+ * Plan a move to (X, Y, Z), set the current_position, and wait for it to finish
+ */
+void do_blocking_move_to(const float rx, const float ry, const float rz, const feedRate_t &fr_mm_s/*=0.0*/) {
+  DEBUG_SECTION(log_move, "do_blocking_move_to", DEBUGGING(LEVELING));
+  do_queued_move_to(rx, ry, rz, fr_mm_s);
   planner.synchronize();
 }
 
@@ -1611,7 +1617,7 @@ void homeaxis(const AxisEnum axis) {
         case Y_AXIS: es = Y_ENDSTOP; break;
         case Z_AXIS: es = Z_ENDSTOP; break;
       }
-      if (TEST(endstops.state(), es)) {
+      if (TEST(TERN(ENDSTOP_POLL_APPROACH_ONLY, endstops.refresh(), endstops.state()), es)) {
         SERIAL_ECHO_MSG("Bad ", axis_codes[axis], " Endstop?");
         kill(GET_TEXT(MSG_KILL_HOMING_FAILED));
       }
@@ -186,7 +186,7 @@ void sync_plan_position_e();
 void line_to_current_position(const feedRate_t &fr_mm_s=feedrate_mm_s);
 
 #if EXTRUDERS
-  void unscaled_e_move(const float &length, const feedRate_t &fr_mm_s);
+  void unscaled_e_move(const float &length, const feedRate_t &fr_mm_s, const bool sync=true);
 #endif
 
 void prepare_line_to_destination();
@@ -230,6 +230,11 @@ void do_blocking_move_to_xy_z(const xy_pos_t &raw, const float &z, const feedRat
 FORCE_INLINE void do_blocking_move_to_xy_z(const xyz_pos_t &raw, const float &z, const feedRate_t &fr_mm_s=0.0f)  { do_blocking_move_to_xy_z(xy_pos_t(raw), z, fr_mm_s); }
 FORCE_INLINE void do_blocking_move_to_xy_z(const xyze_pos_t &raw, const float &z, const feedRate_t &fr_mm_s=0.0f) { do_blocking_move_to_xy_z(xy_pos_t(raw), z, fr_mm_s); }
 
+/**
+ * Plan the same moves as do_blocking_move_to without waiting for them
+ */
+void do_queued_move_to(const float rx, const float ry, const float rz, const feedRate_t &fr_mm_s=0.0f);
+
 void remember_feedrate_and_scaling();
 void remember_feedrate_scaling_off();
 void restore_feedrate_and_scaling();
@@ -99,6 +99,10 @@
   #include "../feature/backlash.h"
 #endif
 
+#if ENABLED(BABYSTEP_PLANNED)
+  #include "../feature/babystep.h"
+#endif
+
 #if ENABLED(CANCEL_OBJECTS)
   #include "../feature/cancel_object.h"
 #endif
@@ -130,6 +134,10 @@ volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+#if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+  uint16_t Planner::block_sequence; // = 0
+#endif
+
 planner_settings_t Planner::settings;           // Initialized by settings.load()
 
 #if ENABLED(LASER_POWER_INLINE)
@@ -1275,6 +1283,23 @@ void Planner::recalculate() {
 
 #endif // AUTOTEMP
 
+#if ENABLED(MPCTEMP)
+
+  float Planner::extrusion_speed_ahead(const uint8_t extruder, const float &horizon) {
+    float e_mm = 0, secs = 0;
+    const uint8_t head = block_buffer_head;
+    for (uint8_t b = block_buffer_tail; b != head && secs < horizon; b = next_block_index(b)) {
+      const block_t * const block = &block_buffer[b];
+      if (!block->nominal_speed_sqr) continue;
+      secs += block->millimeters / SQRT(block->nominal_speed_sqr);
+      if (block->extruder == extruder && !TEST(block->direction_bits, E_AXIS))
+        e_mm += block->steps.e * steps_to_mm[E_AXIS_N(extruder)];
+    }
+    return secs > 0 ? e_mm / secs : 0;
+  }
+
+#endif // MPCTEMP
+
 /**
  * Maintain fans, paste extruder pressure,
  */
@@ -1701,6 +1726,8 @@ bool Planner::_buffer_steps(const xyze_long_t &target
     delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
   }
 
+  TERN_(MMU2_ASYNC_TOOL_CHANGE, block->sequence = block_sequence++);
+
   // Move buffer head
   block_buffer_head = next_buffer_head;
 
@@ -1733,9 +1760,17 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
 ) {
 
-  const int32_t da = target.a - position.a,
-                db = target.b - position.b,
-                dc = target.c - position.c;
+  #if ENABLED(BABYSTEP_PLANNED)
+    // Carry any waiting babysteps in this block. The logical position doesn't change.
+    const xyz_int_t bs = { babystep.planned_steps(X_AXIS), babystep.planned_steps(Y_AXIS), babystep.planned_steps(Z_AXIS) };
+    const int32_t da = target.a - position.a + bs.a,
+                  db = target.b - position.b + bs.b,
+                  dc = target.c - position.c + bs.c;
+  #else
+    const int32_t da = target.a - position.a,
+                  db = target.b - position.b,
+                  dc = target.c - position.c;
+  #endif
 
   #if EXTRUDERS
     int32_t de = target.e - position.e;
@@ -1833,6 +1868,13 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     laser_inline.status.isPlanned = true;
     block->laser.status = laser_inline.status;
     block->laser.power = laser_inline.power;
+    #if ENABLED(LASER_RASTER)
+      block->laser.raster.pixels = laser_inline.raster.pixels;
+      if (laser_inline.raster.pixels) {
+        COPY(block->laser.raster.power, laser_inline.raster.power);
+        laser_inline.raster.pixels = 0;   // Only one block per G7 line
+      }
+    #endif
   #endif
 
   // Number of steps for each axis
@@ -1936,9 +1978,23 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   block->step_event_count = _MAX(block->steps.a, block->steps.b, block->steps.c, esteps);
 
+  #if ENABLED(LASER_RASTER)
+    // Spread the pixels evenly over the block's step events
+    if (block->laser.raster.pixels) {
+      const uint8_t pixels = block->laser.raster.pixels;
+      block->laser.raster.steps_per_pixel = _MAX(1UL, (block->step_event_count + pixels / 2) / pixels);
+    }
+  #endif
+
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
+  // The babysteps are in this block now
+  #if ENABLED(BABYSTEP_PLANNED)
+    block->babysteps = bs;
+    babystep.clear_planned();
+  #endif
+
   #if ENABLED(MIXING_EXTRUDER)
     MIXER_POPULATE_BLOCK();
   #endif
@@ -2624,11 +2680,30 @@ void Planner::buffer_sync_block() {
     delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
   }
 
+  TERN_(MMU2_ASYNC_TOOL_CHANGE, block->sequence = block_sequence++);
   block_buffer_head = next_buffer_head;
 
   stepper.wake_up();
 } // buffer_sync_block()
 
+#if ENABLED(BABYSTEP_PLANNED)
+
+  /**
+   * Add a block with no logical movement, just the babysteps. It's
+   * dropped, keeping the babysteps waiting, until they add up to
+   * MIN_STEPS_PER_SEGMENT or a move comes along to carry them.
+   */
+  void Planner::buffer_babysteps() {
+    if (_buffer_steps(position
+        #if HAS_POSITION_FLOAT
+          , position_float
+        #endif
+        , MMM_TO_MMS(HOMING_FEEDRATE_Z), active_extruder)
+    ) stepper.wake_up();
+  }
+
+#endif
+
 /**
  * Planner::buffer_segment
  *
@@ -2711,6 +2786,43 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
     SERIAL_ECHOLNPGM(")");
   //*/
 
+  #if ENABLED(BACKLASH_TAKEUP_MOVE)
+    // Take up backlash in a block of its own ahead of a move that reverses.
+    // The logical position stays put while the motors move.
+    xyz_long_t takeup;
+    if (backlash.get_takeup_steps(target.a - position.a, target.b - position.b, target.c - position.c, takeup)) {
+      const xyze_long_t takeup_target = { position.a + takeup.a, position.b + takeup.b, position.c + takeup.c, position.e };
+
+      #if ENABLED(LASER_POWER_INLINE)
+        // The head stands still, so keep the laser off and leave any G7 raster for the move
+        const power_status_t laser_status = laser_inline.status;
+        const uint8_t laser_power = laser_inline.power;
+        laser_inline.status.isEnabled = false;
+        laser_inline.power = 0;
+        #if ENABLED(LASER_RASTER)
+          const uint8_t raster_pixels = laser_inline.raster.pixels;
+          laser_inline.raster.pixels = 0;
+        #endif
+      #endif
+
+      const bool queued = _buffer_steps(takeup_target
+        #if HAS_POSITION_FLOAT
+          , position_float
+        #endif
+        , fr_mm_s, extruder
+      );
+
+      #if ENABLED(LASER_POWER_INLINE)
+        laser_inline.status = laser_status;
+        laser_inline.power = laser_power;
+        TERN_(LASER_RASTER, laser_inline.raster.pixels = raster_pixels);
+      #endif
+
+      if (!queued) return false;
+      LOOP_XYZ(i) position[i] -= takeup[i];
+    }
+  #endif
+
   // Queue the movement. Return 'false' if the move was not queued.
   if (!_buffer_steps(target
       #if HAS_POSITION_FLOAT
@@ -2801,6 +2913,8 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
 
     block->flag = BLOCK_FLAG_IS_PAGE;
 
+    TERN_(BABYSTEP_PLANNED, block->babysteps.reset()); // Page steps carry no babysteps
+
     #if FAN_COUNT > 0
       FANS_LOOP(i) block->fan_speed[i] = thermalManager.fan_speed[i];
     #endif
@@ -2842,6 +2956,8 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
       delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
     }
 
+    TERN_(MMU2_ASYNC_TOOL_CHANGE, block->sequence = block_sequence++);
+
     // Move buffer head
     block_buffer_head = next_buffer_head;
 
@@ -123,9 +123,20 @@ enum BlockFlag : char {
     bool Reserved:6;
   } power_status_t;
 
+  #if ENABLED(LASER_RASTER)
+    typedef struct {
+      uint8_t pixels;                         // Pixels spread over the block (0 = not a raster block)
+      uint32_t steps_per_pixel;               // Step events per pixel
+      uint8_t power[LASER_RASTER_MAX_PIXELS]; // OCR power of each pixel
+    } laser_raster_t;
+  #endif
+
   typedef struct {
     power_status_t status;    // See planner settings for meaning
     uint8_t power;            // Ditto; When in trapezoid mode this is nominal power
+    #if ENABLED(LASER_RASTER)
+      laser_raster_t raster;  // Per-pixel power for G7 raster lines
+    #endif
     #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
       uint8_t   power_entry;  // Entry power for the laser
       #if DISABLED(LASER_POWER_INLINE_TRAPEZOID_CONT)
@@ -230,6 +241,14 @@ typedef struct block_t {
     block_laser_t laser;
   #endif
 
+  #if ENABLED(BABYSTEP_PLANNED)
+    xyz_int_t babysteps;                    // Babysteps carried in the steps, kept out of the stepper count
+  #endif
+
+  #if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+    uint16_t sequence;                      // Order in which the block was queued
+  #endif
+
 } block_t;
 
 #if ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL)
@@ -252,6 +271,13 @@ typedef struct block_t {
      * floating point operations during the move loop.
      */
     uint8_t power;
+    #if ENABLED(LASER_RASTER)
+      /**
+       * Pixels for the next block, set by G7.
+       * Consumed by the first block planned after it.
+       */
+      laser_raster_t raster;
+    #endif
   } laser_state_t;
 #endif
 
@@ -311,6 +337,10 @@ class Planner {
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+    #if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+      static uint16_t block_sequence;               // Sequence number for the next block queued
+    #endif
+
 
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;                 // Respond to extruder change
@@ -636,6 +666,15 @@ class Planner {
     // Get count of movement slots free
     FORCE_INLINE static uint8_t moves_free() { return BLOCK_BUFFER_SIZE - 1 - movesplanned(); }
 
+    #if ENABLED(MPCTEMP)
+      /**
+       * Average filament speed (mm/s) of the given extruder over the
+       * queued moves, looking up to 'horizon' seconds ahead. Retractions
+       * and moves of other extruders add time but no filament.
+       */
+      static float extrusion_speed_ahead(const uint8_t extruder, const float &horizon);
+    #endif
+
     /**
      * Planner::get_next_free_block
      *
@@ -653,6 +692,17 @@ class Planner {
       return &block_buffer[block_buffer_head];
     }
 
+    #if ENABLED(MMU2_ASYNC_TOOL_CHANGE)
+      /**
+       * Have all the blocks queued before the given sequence number been executed?
+       * Unlike buffer indexes, the sequence doesn't repeat as the ring wraps.
+       */
+      static bool blocks_done_before(const uint16_t seq) {
+        const uint8_t tail = block_buffer_tail;
+        return tail == block_buffer_head || int16_t(block_buffer[tail].sequence - seq) >= 0;
+      }
+    #endif
+
     /**
      * Planner::_buffer_steps
      *
@@ -704,6 +754,14 @@ class Planner {
      */
     static void buffer_sync_block();
 
+    #if ENABLED(BABYSTEP_PLANNED)
+      /**
+       * Planner::buffer_babysteps
+       * Add a block in place to carry babysteps when no moves are coming
+       */
+      static void buffer_babysteps();
+    #endif
+
   #if IS_KINEMATIC
     private:
 
@@ -41,6 +41,10 @@ Stopwatch print_job_timer;      // Global Print Job Timer instance
   #include "../libs/buzzer.h"
 #endif
 
+#if ENABLED(PRINTCOUNTER_JOB_LOG)
+  #include "../feature/joblog.h"
+#endif
+
 // Service intervals
 #if HAS_SERVICE_INTERVALS
   #if SERVICE_INTERVAL_1 > 0
@@ -243,6 +247,14 @@ void PrintCounter::tick() {
     update_next = now + updateInterval * 1000;
   }
 
+  #if ENABLED(PRINTCOUNTER_JOB_LOG)
+    static millis_t sample_next; // = 0
+    if (ELAPSED(now, sample_next)) {
+      sample_next = now + 1000;
+      job_log.sample();
+    }
+  #endif
+
   static uint32_t eeprom_next; // = 0
   if (ELAPSED(now, eeprom_next)) {
     eeprom_next = now + saveInterval * 1000;
@@ -260,6 +272,7 @@ bool PrintCounter::start() {
     if (!paused) {
       data.totalPrints++;
       lastDuration = 0;
+      TERN_(PRINTCOUNTER_JOB_LOG, job_log.start(data.filamentUsed));
     }
     return true;
   }
@@ -279,6 +292,7 @@ bool PrintCounter::stop() {
       data.longestPrint = duration();
 
     saveStats();
+    TERN_(PRINTCOUNTER_JOB_LOG, job_log.finish(duration(), data.filamentUsed));
     return true;
   }
   else return false;
@@ -88,6 +88,11 @@ Probe probe;
 
 xyz_pos_t Probe::offset; // Initialized by settings.load()
 
+#if ENABLED(FAST_GRID_PROBING)
+  bool Probe::grid_walking; // = false
+  float Probe::z_hint = NAN;
+#endif
+
 #if HAS_PROBE_XY_OFFSET
   const xyz_pos_t &Probe::offset_xy = Probe::offset;
 #endif
@@ -520,30 +525,53 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
   // If Z isn't known then probe to -10mm.
   const float z_probe_low_point = TEST(axis_known_position, Z_AXIS) ? -offset.z + Z_PROBE_LOW_POINT : -10.0;
 
+  #if ENABLED(FAST_GRID_PROBING)
+    // Drop quickly to just above the height found at the previous grid point
+    // and go straight to the slow probe. A trigger on the way down means the
+    // bed is higher here, so back off and probe the usual way.
+    bool hinted = false;
+    if (grid_walking && !isnan(z_hint) && current_position.z > z_hint + FAST_GRID_PROBING_MARGIN) {
+      const bool missed = probe_down_to_z(z_hint + FAST_GRID_PROBING_MARGIN, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      if (missed)
+        hinted = true;    // Stopped short of the bed, ready for the slow probe
+      else
+        do_blocking_move_to_z(current_position.z + Z_CLEARANCE_MULTI_PROBE, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    }
+  #endif
+
   // Double-probing does a fast probe followed by a slow probe
   #if TOTAL_PROBING == 2
 
-    // Do a first probe at the fast speed
-    if (try_to_probe(PSTR("FAST"), z_probe_low_point, MMM_TO_MMS(Z_PROBE_SPEED_FAST),
-                     sanity_check, Z_CLEARANCE_BETWEEN_PROBES) ) return NAN;
+    float first_probe_z = NAN;
 
-    const float first_probe_z = current_position.z;
+    if (!TERN0(FAST_GRID_PROBING, hinted)) {
+      // Do a first probe at the fast speed
+      if (try_to_probe(PSTR("FAST"), z_probe_low_point, MMM_TO_MMS(Z_PROBE_SPEED_FAST),
+                       sanity_check, Z_CLEARANCE_BETWEEN_PROBES) ) return NAN;
 
-    if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("1st Probe Z:", first_probe_z);
+      first_probe_z = current_position.z;
 
-    // Raise to give the probe clearance
-    do_blocking_move_to_z(current_position.z + Z_CLEARANCE_MULTI_PROBE, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("1st Probe Z:", first_probe_z);
+
+      // Raise to give the probe clearance
+      do_blocking_move_to_z(current_position.z + Z_CLEARANCE_MULTI_PROBE, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    }
 
   #elif Z_PROBE_SPEED_FAST != Z_PROBE_SPEED_SLOW
 
     // If the nozzle is well over the travel height then
     // move down quickly before doing the slow probe
     const float z = Z_CLEARANCE_DEPLOY_PROBE + 5.0 + (offset.z < 0 ? -offset.z : 0);
-    if (current_position.z > z) {
+    if (!TERN0(FAST_GRID_PROBING, hinted) && current_position.z > z) {
       // Probe down fast. If the probe never triggered, raise for probe clearance
       if (!probe_down_to_z(z, MMM_TO_MMS(Z_PROBE_SPEED_FAST)))
         do_blocking_move_to_z(current_position.z + Z_CLEARANCE_BETWEEN_PROBES, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
     }
+
+  #elif ENABLED(FAST_GRID_PROBING)
+
+    UNUSED(hinted); // A single slow probe. The hint only shortened the descent.
+
   #endif
 
   #if EXTRA_PROBING > 0
@@ -623,7 +651,8 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("2nd Probe Z:", z2, " Discrepancy:", first_probe_z - z2);
 
     // Return a weighted average of the fast and slow probes
-    const float measured_z = (z2 * 3.0 + first_probe_z * 2.0) * 0.2;
+    // (only the slow probe when it came from the previous point's height)
+    const float measured_z = TERN0(FAST_GRID_PROBING, hinted) ? z2 : (z2 * 3.0 + first_probe_z * 2.0) * 0.2;
 
   #else
 
@@ -632,6 +661,8 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
   #endif
 
+  TERN_(FAST_GRID_PROBING, if (grid_walking) z_hint = current_position.z);
+
   return measured_z;
 }
 
@@ -691,8 +722,18 @@ float Probe::probe_at_point(const float &rx, const float &ry, const ProbePtRaise
   if (!deploy()) measured_z = run_z_probe(sanity_check) + offset.z;
   if (!isnan(measured_z)) {
     const bool big_raise = raise_after == PROBE_PT_BIG_RAISE;
-    if (big_raise || raise_after == PROBE_PT_RAISE)
-      do_blocking_move_to_z(current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    if (big_raise || raise_after == PROBE_PT_RAISE) {
+      const float z_raise = current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES);
+      #if ENABLED(FAST_GRID_PROBING) && !IS_KINEMATIC
+        if (grid_walking) {
+          // Leave the raise queued so it runs straight into the travel to the next point
+          current_position.z = z_raise;
+          line_to_current_position(MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+        }
+        else
+      #endif
+          do_blocking_move_to_z(z_raise, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+    }
     else if (raise_after == PROBE_PT_STOW)
       if (stow()) measured_z = NAN;   // Error on stow?
 
@@ -96,6 +96,11 @@ public:
       return probe_at_point(pos.x, pos.y, raise_after, verbose_level, probe_relative, sanity_check);
     }
 
+    #if ENABLED(FAST_GRID_PROBING)
+      // While walking a grid, approach each point from the height of the last one
+      static inline void grid_walk(const bool on) { grid_walking = on; z_hint = NAN; }
+    #endif
+
   #else
 
     FORCE_INLINE static void move_z_after_homing() {}
@@ -218,6 +223,11 @@ public:
   #endif
 
 private:
+  #if ENABLED(FAST_GRID_PROBING)
+    static bool grid_walking;
+    static float z_hint;      // Trigger height at the previous grid point, or NAN
+  #endif
+
   static bool probe_down_to_z(const float z, const feedRate_t fr_mm_s);
   static void do_z_raise(const float z_raise);
   static float run_z_probe(const bool sanity_check=true);
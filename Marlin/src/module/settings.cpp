@@ -307,6 +307,13 @@ typedef struct SettingsDataStruct {
   //
   PID_t bedPID;                                         // M304 PID / M303 E-1 U
 
+  //
+  // MPCTEMP
+  //
+  #if ENABLED(MPCTEMP)
+    MPC_t mpc_constants[HOTENDS];                       // M306 En PCRAFH / M306 En T
+  #endif
+
   //
   // User-defined Thermistors
   //
@@ -893,6 +900,16 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(bed_pid);
     }
 
+    //
+    // MPCTEMP
+    //
+    #if ENABLED(MPCTEMP)
+    {
+      _FIELD_TEST(mpc_constants);
+      HOTEND_LOOP() EEPROM_WRITE(thermalManager.temp_hotend[e].constants);
+    }
+    #endif
+
     //
     // User-defined Thermistors
     //
@@ -1773,6 +1790,20 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // Hotend MPC
+      //
+      #if ENABLED(MPCTEMP)
+      {
+        _FIELD_TEST(mpc_constants);
+        HOTEND_LOOP() {
+          MPC_t mpc;
+          EEPROM_READ(mpc);
+          if (!validating) thermalManager.temp_hotend[e].constants = mpc;
+        }
+      }
+      #endif
+
       //
       // User-defined Thermistors
       //
@@ -2383,7 +2414,7 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
-    void MarlinSettings::load_mesh(const int8_t slot, void * const into/*=nullptr*/) {
+    bool MarlinSettings::load_mesh(const int8_t slot, void * const into/*=nullptr*/) {
 
       #if ENABLED(AUTO_BED_LEVELING_UBL)
 
@@ -2391,7 +2422,7 @@ void MarlinSettings::postprocess() {
 
         if (!WITHIN(slot, 0, a - 1)) {
           ubl_invalid_slot(a);
-          return;
+          return false;
         }
 
         int pos = mesh_slot_offset(slot);
@@ -2406,10 +2437,12 @@ void MarlinSettings::postprocess() {
         else        DEBUG_ECHOLNPAIR("Mesh loaded from slot ", slot);
 
         EEPROM_FINISH();
+        return !status;
 
       #else
 
         // Other mesh types
+        return false;
 
       #endif
     }
@@ -2724,6 +2757,43 @@ void MarlinSettings::reset() {
     thermalManager.temp_bed.pid.Kd = scalePID_d(DEFAULT_bedKd);
   #endif
 
+  //
+  // Hotend MPC
+  //
+  #if ENABLED(MPCTEMP)
+  {
+    constexpr float heater_power[] = MPC_HEATER_POWER,
+                    block_heat_capacity[] = MPC_BLOCK_HEAT_CAPACITY,
+                    sensor_responsiveness[] = MPC_SENSOR_RESPONSIVENESS,
+                    ambient_xfer_coeff_fan0[] = MPC_AMBIENT_XFER_COEFF,
+                    #if ENABLED(MPC_INCLUDE_FAN)
+                      ambient_xfer_coeff_fan255[] = MPC_AMBIENT_XFER_COEFF_FAN255,
+                    #endif
+                    filament_heat_capacity_permm[] = FILAMENT_HEAT_CAPACITY_PERMM;
+
+    static_assert(WITHIN(COUNT(heater_power), 1, HOTENDS), "MPC_HEATER_POWER must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(block_heat_capacity), 1, HOTENDS), "MPC_BLOCK_HEAT_CAPACITY must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(sensor_responsiveness), 1, HOTENDS), "MPC_SENSOR_RESPONSIVENESS must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(ambient_xfer_coeff_fan0), 1, HOTENDS), "MPC_AMBIENT_XFER_COEFF must have between 1 and HOTENDS items.");
+    #if ENABLED(MPC_INCLUDE_FAN)
+      static_assert(WITHIN(COUNT(ambient_xfer_coeff_fan255), 1, HOTENDS), "MPC_AMBIENT_XFER_COEFF_FAN255 must have between 1 and HOTENDS items.");
+    #endif
+    static_assert(WITHIN(COUNT(filament_heat_capacity_permm), 1, HOTENDS), "FILAMENT_HEAT_CAPACITY_PERMM must have between 1 and HOTENDS items.");
+
+    HOTEND_LOOP() {
+      MPC_t &constants = thermalManager.temp_hotend[e].constants;
+      constants.heater_power = heater_power[ALIM(e, heater_power)];
+      constants.block_heat_capacity = block_heat_capacity[ALIM(e, block_heat_capacity)];
+      constants.sensor_responsiveness = sensor_responsiveness[ALIM(e, sensor_responsiveness)];
+      constants.ambient_xfer_coeff_fan0 = ambient_xfer_coeff_fan0[ALIM(e, ambient_xfer_coeff_fan0)];
+      #if ENABLED(MPC_INCLUDE_FAN)
+        constants.fan255_adjustment = ambient_xfer_coeff_fan255[ALIM(e, ambient_xfer_coeff_fan255)] - constants.ambient_xfer_coeff_fan0;
+      #endif
+      constants.filament_heat_capacity_permm = filament_heat_capacity_permm[ALIM(e, filament_heat_capacity_permm)];
+    }
+  }
+  #endif
+
   //
   // User-Defined Thermistors
   //
@@ -3294,6 +3364,23 @@ void MarlinSettings::reset() {
 
     #endif // PIDTEMP || PIDTEMPBED
 
+    #if ENABLED(MPCTEMP)
+      CONFIG_ECHO_HEADING("Model predictive control:");
+      HOTEND_LOOP() {
+        const MPC_t &constants = thermalManager.temp_hotend[e].constants;
+        CONFIG_ECHO_START();
+        SERIAL_ECHOPAIR("  M306 E", int(e));
+        SERIAL_ECHOPAIR_F(" P", constants.heater_power, 2);
+        SERIAL_ECHOPAIR_F(" C", constants.block_heat_capacity, 2);
+        SERIAL_ECHOPAIR_F(" R", constants.sensor_responsiveness, 4);
+        SERIAL_ECHOPAIR_F(" A", constants.ambient_xfer_coeff_fan0, 4);
+        #if ENABLED(MPC_INCLUDE_FAN)
+          SERIAL_ECHOPAIR_F(" F", constants.ambient_xfer_coeff_fan0 + constants.fan255_adjustment, 4);
+        #endif
+        SERIAL_ECHOLNPAIR_F(" H", constants.filament_heat_capacity_permm, 4);
+      }
+    #endif
+
     #if HAS_USER_THERMISTORS
       CONFIG_ECHO_HEADING("User thermistors:");
       LOOP_L_N(i, USER_THERMISTORS)
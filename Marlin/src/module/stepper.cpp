@@ -136,6 +136,10 @@ Stepper stepper; // Singleton
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(STEPPER_TRACE)
+  #include "../feature/stepper_trace.h"
+#endif
+
 // public:
 
 #if EITHER(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -254,6 +258,10 @@ xyze_int8_t Stepper::count_direction{0};
   };
 #endif
 
+#if ENABLED(LASER_RASTER)
+  Stepper::stepper_raster_t Stepper::laser_raster = { 0, 0 };
+#endif
+
 #define DUAL_ENDSTOP_APPLY_STEP(A,V)                                                                                        \
   if (separate_multi_axis) {                                                                                                \
     if (A##_HOME_DIR < 0) {                                                                                                 \
@@ -1366,6 +1374,8 @@ void Stepper::isr() {
   // periods to big periods are respected and the timer does not reset to 0
   HAL_timer_set_compare(STEP_TIMER_NUM, hal_timer_t(HAL_TIMER_TYPE_MAX));
 
+  TERN_(STEPPER_TRACE, stepper_trace.log(TRACE_STEP_ISR));
+
   // Count of ticks for the next ISR
   hal_timer_t next_isr_ticks = 0;
 
@@ -1498,6 +1508,8 @@ void Stepper::isr() {
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(STEP_TIMER_NUM, hal_timer_t(next_isr_ticks));
 
+  TERN_(STEPPER_TRACE, stepper_trace.log(TRACE_STEP_INTERVAL, next_isr_ticks, 10 - max_loops));
+
   // Don't forget to finally reenable interrupts
   ENABLE_ISRS();
 }
@@ -1806,11 +1818,26 @@ uint32_t Stepper::block_phase_isr() {
         }
       #endif
       TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, runout.block_completed(current_block));
+      TERN_(STEPPER_TRACE, stepper_trace.log(TRACE_BLOCK_END));
       discard_current_block();
     }
     else {
       // Step events not completed yet...
 
+      // Update laser - Switch to the pixel under the head
+      #if ENABLED(LASER_RASTER)
+        if (current_block->laser.raster.pixels && step_events_completed >= laser_raster.next_step) {
+          const laser_raster_t &raster = current_block->laser.raster;
+          const uint8_t last = raster.pixels - 1;
+          while (laser_raster.pixel < last && step_events_completed >= laser_raster.next_step) {
+            laser_raster.pixel++;
+            laser_raster.next_step += raster.steps_per_pixel;
+          }
+          if (laser_raster.pixel == last) laser_raster.next_step = UINT32_MAX;
+          cutter.set_ocr_power(current_block->laser.status.isEnabled ? raster.power[laser_raster.pixel] : 0);
+        }
+      #endif
+
       // Are we in acceleration phase ?
       if (step_events_completed <= accelerate_until) { // Calculate new timer value
 
@@ -1997,6 +2024,14 @@ uint32_t Stepper::block_phase_isr() {
           return interval; // No more queued movements!
       }
 
+      TERN_(STEPPER_TRACE, stepper_trace.log(TRACE_BLOCK_START, current_block->step_event_count));
+
+      #if ENABLED(BABYSTEP_PLANNED)
+        // The block's babysteps are counted as they step, so take them out up front.
+        // Positions read from the steppers then match the planner's at the block's end.
+        LOOP_XYZ(i) count_position[i] -= current_block->babysteps[i];
+      #endif
+
       // For non-inline cutter, grossly apply power
       #if ENABLED(LASER_FEATURE) && DISABLED(LASER_POWER_INLINE)
         cutter.apply_power(current_block->cutter_power);
@@ -2195,6 +2230,16 @@ uint32_t Stepper::block_phase_isr() {
         #endif
       #endif // LASER_POWER_INLINE
 
+      // Raster blocks take their power from the first pixel instead
+      #if ENABLED(LASER_RASTER)
+        if (current_block->laser.raster.pixels) {
+          TERN_(LASER_POWER_INLINE_TRAPEZOID, laser_trap.enabled = false);
+          laser_raster.pixel = 0;
+          laser_raster.next_step = current_block->laser.raster.steps_per_pixel;
+          cutter.set_ocr_power(stat.isEnabled ? current_block->laser.raster.power[0] : 0);
+        }
+      #endif
+
       // At this point, we must ensure the movement about to execute isn't
       // trying to force the head against a limit switch. If using interrupt-
       // driven change detection, and already against a limit then no call to
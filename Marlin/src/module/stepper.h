@@ -372,6 +372,17 @@ class Stepper {
 
     #endif
 
+    #if ENABLED(LASER_RASTER)
+
+      typedef struct {
+        uint8_t pixel;      // Pixel being burned
+        uint32_t next_step; // Step event where the next pixel starts
+      } stepper_raster_t;
+
+      static stepper_raster_t laser_raster;
+
+    #endif
+
   public:
     // Initialize stepper hardware
     static void init();
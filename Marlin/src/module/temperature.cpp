@@ -73,11 +73,11 @@
   #include "../libs/private_spi.h"
 #endif
 
-#if ENABLED(PID_EXTRUSION_SCALING)
+#if EITHER(PID_EXTRUSION_SCALING, MPCTEMP)
   #include "stepper.h"
 #endif
 
-#if ENABLED(BABYSTEPPING) && DISABLED(INTEGRATED_BABYSTEPPING)
+#if ENABLED(BABYSTEPPING) && NONE(INTEGRATED_BABYSTEPPING, BABYSTEP_PLANNED)
   #include "../feature/babystep.h"
 #endif
 
@@ -111,6 +111,10 @@
   #include "../libs/buzzer.h"
 #endif
 
+#if ENABLED(STEPPER_TRACE)
+  #include "../feature/stepper_trace.h"
+#endif
+
 #if HOTEND_USES_THERMISTOR
   #if ENABLED(TEMP_SENSOR_1_AS_REDUNDANT)
     static const temp_entry_t* heater_ttbl_map[2] = { HEATER_0_TEMPTABLE, HEATER_1_TEMPTABLE };
@@ -311,6 +315,10 @@ const char str_t_thermal_runaway[] PROGMEM = STR_T_THERMAL_RUNAWAY,
 
 volatile bool Temperature::raw_temps_ready = false;
 
+#if ENABLED(MPCTEMP)
+  int32_t Temperature::mpc_e_position; // = 0
+#endif
+
 #if ENABLED(PID_EXTRUSION_SCALING)
   int32_t Temperature::last_e_position, Temperature::lpq[LPQ_MAX_LEN];
   lpq_ptr_t Temperature::lpq_ptr = 0;
@@ -645,6 +653,271 @@ volatile bool Temperature::raw_temps_ready = false;
 
 #endif // HAS_PID_HEATING
 
+#if ENABLED(MPCTEMP)
+
+  /**
+   * MPC Autotuning (M306 T)
+   *
+   * Let the hotend cool to room temperature, then heat it at full power
+   * while sampling the temperature curve. Fit the heat capacity and the
+   * sensor lag to the curve, then hold the temperature under MPC to
+   * measure the power lost to the air with the fan off and at full speed.
+   */
+  void Temperature::MPC_autotune(const uint8_t e) {
+    MPCHeaterInfo &hotend = temp_hotend[e];
+    MPC_t &constants = hotend.constants;
+
+    #if ENABLED(MPC_INCLUDE_FAN)
+      const uint8_t fan_index = e < (FAN_COUNT) ? e : 0;
+      #define SET_TUNING_FAN(S) set_fan_speed(fan_index, S)
+    #else
+      #define SET_TUNING_FAN(S) NOOP
+    #endif
+
+    if (MPC_TUNING_TEMP > temp_range[e].maxtemp - (HOTEND_OVERSHOOT)) {
+      SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
+      return;
+    }
+
+    float current_temp = hotend.celsius;
+    millis_t next_report_ms = millis();
+
+    // Each phase gives up after MAX_CYCLE_TIME_PID_AUTOTUNE minutes
+    #ifndef MAX_CYCLE_TIME_PID_AUTOTUNE
+      #define MAX_CYCLE_TIME_PID_AUTOTUNE 20L
+    #endif
+    #ifndef MAX_OVERSHOOT_PID_AUTOTUNE
+      #define MAX_OVERSHOOT_PID_AUTOTUNE 30
+    #endif
+    millis_t phase_timeout_ms;
+    auto start_phase = [&]() { phase_timeout_ms = millis() + MAX_CYCLE_TIME_PID_AUTOTUNE * 60L * 1000L; };
+
+    // Wait for the next temperature sample. False if interrupted by M108, overheating or timed out.
+    auto housekeeping = [&]() -> bool {
+      while (!raw_temps_ready) {
+        if (!wait_for_heatup) {
+          SERIAL_ECHOLNPGM("MPC autotune interrupted!");
+          return false;
+        }
+        TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+      }
+      updateTemperaturesFromRawValues();
+      current_temp = hotend.celsius;
+
+      if (current_temp > temp_range[e].maxtemp - (HOTEND_OVERSHOOT)) {
+        SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
+        return false;
+      }
+
+      if (ELAPSED(millis(), phase_timeout_ms)) {
+        SERIAL_ECHOLNPGM(STR_PID_TIMEOUT);
+        return false;
+      }
+
+      #if HAS_AUTO_FAN
+        const millis_t ms = millis();
+        if (ELAPSED(ms, next_auto_fan_check_ms)) {
+          checkExtruderAutoFans();
+          next_auto_fan_check_ms = ms + 2500UL;
+        }
+      #endif
+
+      // Report heater states every 2 seconds
+      if (ELAPSED(millis(), next_report_ms)) {
+        print_heater_states(e);
+        SERIAL_EOL();
+        next_report_ms = millis() + 2000UL;
+      }
+      return true;
+    };
+
+    const MPC_t saved_constants = constants;
+    auto finish = [&](const bool success) {
+      if (!success) constants = saved_constants;
+      SET_TUNING_FAN(0);
+      disable_all_heaters();
+    };
+
+    SERIAL_ECHOLNPAIR("MPC autotune start for E", int(e));
+
+    disable_all_heaters();
+    TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+    TERN_(HAS_AUTO_FAN, next_auto_fan_check_ms = millis() + 2500UL);
+
+    wait_for_heatup = true; // Can be interrupted with M108
+
+    // Cool down with the fan on until the temperature stops falling
+    SERIAL_ECHOLNPGM("Cooling to ambient");
+    SET_TUNING_FAN(255);
+    start_phase();
+    if (!housekeeping()) return finish(false);
+    float last_temp = current_temp;
+    millis_t next_test_ms = millis() + 10000UL;
+    for (;;) {
+      if (!housekeeping()) return finish(false);
+      if (ELAPSED(millis(), next_test_ms)) {
+        if (last_temp - current_temp < 0.1f) break;
+        last_temp = current_temp;
+        next_test_ms += 10000UL;
+      }
+    }
+    SET_TUNING_FAN(0);
+    const float ambient_temp = current_temp;
+
+    // Heat at full power, sampling the upper half of the curve at
+    // even intervals. Keep every other sample when the array fills.
+    SERIAL_ECHOLNPGM("Heating to " STRINGIFY(MPC_TUNING_TEMP) "C");
+    hotend.target = MPC_TUNING_TEMP;
+    hotend.soft_pwm_amount = (MPC_MAX) >> 1;
+
+    const float sample_start_temp = (ambient_temp + (MPC_TUNING_TEMP)) * 0.5f;
+    const millis_t heat_start_ms = millis();
+    constexpr millis_t test_interval_ms = 1000UL;
+    float temp_samples[16], t1_time = 0;
+    uint8_t sample_count = 0;
+    uint16_t sample_distance = 1;
+    next_test_ms = heat_start_ms;
+    start_phase();
+
+    #if ENABLED(WATCH_HOTENDS)
+      // Open-loop heating gets the same watch as PID_autotune
+      float next_watch_temp = current_temp + (WATCH_TEMP_INCREASE);
+      millis_t temp_change_ms = heat_start_ms + SEC_TO_MS(WATCH_TEMP_PERIOD);
+    #endif
+
+    for (;;) {
+      if (!housekeeping()) return finish(false);
+      const millis_t ms = millis();
+
+      #if ENABLED(WATCH_HOTENDS)
+        if (current_temp > next_watch_temp) {
+          next_watch_temp = current_temp + (WATCH_TEMP_INCREASE);
+          temp_change_ms = ms + SEC_TO_MS(WATCH_TEMP_PERIOD);
+        }
+        else if (ELAPSED(ms, temp_change_ms)) {
+          finish(false);
+          _temp_error((heater_ind_t)e, str_t_heating_failed, GET_TEXT(MSG_HEATING_FAILED_LCD));
+          return;
+        }
+      #endif
+
+      if (ELAPSED(ms, next_test_ms)) {
+        if (current_temp >= sample_start_temp) {
+          if (!sample_count && sample_distance == 1) t1_time = (ms - heat_start_ms) * 0.001f;
+          temp_samples[sample_count++] = current_temp;
+          if (sample_count == COUNT(temp_samples)) {
+            // Keep every other sample. The last one kept is a sample back,
+            // so the next one falls a (doubled) interval after that.
+            LOOP_L_N(i, COUNT(temp_samples) / 2) temp_samples[i] = temp_samples[i * 2];
+            sample_count = COUNT(temp_samples) / 2;
+            next_test_ms -= test_interval_ms * sample_distance;
+            sample_distance *= 2;
+          }
+        }
+        if (current_temp >= MPC_TUNING_TEMP) break;
+        next_test_ms += test_interval_ms * sample_distance;
+      }
+    }
+    hotend.soft_pwm_amount = 0;
+
+    if (sample_count < 3) {
+      SERIAL_ECHOLNPGM("MPC autotune failed! Too few samples.");
+      return finish(false);
+    }
+
+    // Fit an exponential approach to three evenly spaced samples
+    sample_count = (sample_count - 1) / 2 * 2 + 1;
+    const float t1 = temp_samples[0],
+                t2 = temp_samples[sample_count >> 1],
+                t3 = temp_samples[sample_count - 1],
+                asymp_temp = (t2 * t2 - t1 * t3) / (2 * t2 - t1 - t3),
+                block_responsiveness = -log((t2 - asymp_temp) / (t1 - asymp_temp)) / (test_interval_ms * 0.001f * sample_distance * (sample_count >> 1));
+
+    if (!(asymp_temp > t3 && block_responsiveness > 0)) {
+      SERIAL_ECHOLNPGM("MPC autotune failed! Heating curve could not be fitted.");
+      return finish(false);
+    }
+
+    MPC_t tuned = constants;
+    tuned.ambient_xfer_coeff_fan0 = tuned.heater_power * (MPC_MAX) / 255 / (asymp_temp - ambient_temp);
+    TERN_(MPC_INCLUDE_FAN, tuned.fan255_adjustment = 0);
+    tuned.block_heat_capacity = tuned.ambient_xfer_coeff_fan0 / block_responsiveness;
+    tuned.sensor_responsiveness = block_responsiveness / (1.0f - (ambient_temp - asymp_temp) * exp(-block_responsiveness * t1_time) / (t1 - asymp_temp));
+
+    // Hold the temperature with the new model and measure the power
+    // needed, first with the fan off and then with the fan at full speed.
+    SERIAL_ECHOLNPGM("Measuring ambient heat loss");
+    constants = tuned;
+    hotend.modeled_ambient_temp = ambient_temp;
+    hotend.modeled_block_temp = hotend.modeled_sensor_temp = current_temp;
+
+    constexpr millis_t settle_time = 20000UL, test_duration = 20000UL;
+    millis_t settle_end_ms = millis() + settle_time,
+             test_end_ms = settle_end_ms + test_duration;
+    float total_energy_fan0 = 0;
+    #if ENABLED(MPC_INCLUDE_FAN)
+      bool fan0_done = false;
+      float total_energy_fan255 = 0;
+    #endif
+    last_temp = current_temp;
+    start_phase();
+    for (;;) {
+      if (!housekeeping()) return finish(false);
+      const millis_t ms = millis();
+      hotend.soft_pwm_amount = (int)get_pid_output_hotend(e) >> 1;
+
+      #if ENABLED(WATCH_HOTENDS)
+        // Heated, then the temperature fell too far?
+        if (current_temp < hotend.target - (MAX_OVERSHOOT_PID_AUTOTUNE)) {
+          finish(false);
+          _temp_error((heater_ind_t)e, str_t_thermal_runaway, GET_TEXT(MSG_THERMAL_RUNAWAY));
+          return;
+        }
+      #endif
+
+      // Energy into the heater, corrected for the heat stored in the block
+      const float energy = constants.heater_power * hotend.soft_pwm_amount / 127 * MPC_dT + (last_temp - current_temp) * constants.block_heat_capacity;
+      last_temp = current_temp;
+
+      if (ELAPSED(ms, settle_end_ms) && !ELAPSED(ms, test_end_ms))
+        TERN(MPC_INCLUDE_FAN, (fan0_done ? total_energy_fan255 : total_energy_fan0), total_energy_fan0) += energy;
+      #if ENABLED(MPC_INCLUDE_FAN)
+        else if (ELAPSED(ms, test_end_ms) && !fan0_done) {
+          SET_TUNING_FAN(255);
+          settle_end_ms = ms + settle_time;
+          test_end_ms = settle_end_ms + test_duration;
+          fan0_done = true;
+        }
+      #endif
+      else if (ELAPSED(ms, test_end_ms))
+        break;
+
+      if (!WITHIN(current_temp, t3 - 15.0f, hotend.target + 15.0f)) {
+        SERIAL_ECHOLNPGM("MPC autotune failed! Temperature deviated too far from target.");
+        return finish(false);
+      }
+    }
+
+    const float power_fan0 = total_energy_fan0 * 1000 / test_duration;
+    constants.ambient_xfer_coeff_fan0 = power_fan0 / (hotend.target - ambient_temp);
+    #if ENABLED(MPC_INCLUDE_FAN)
+      const float power_fan255 = total_energy_fan255 * 1000 / test_duration;
+      constants.fan255_adjustment = power_fan255 / (hotend.target - ambient_temp) - constants.ambient_xfer_coeff_fan0;
+    #endif
+
+    finish(true);
+
+    SERIAL_ECHOLNPGM("MPC autotune finished! Put the constants below into Configuration.h");
+    SERIAL_ECHOLNPAIR("MPC_BLOCK_HEAT_CAPACITY ", constants.block_heat_capacity);
+    SERIAL_ECHOLNPAIR_F("MPC_SENSOR_RESPONSIVENESS ", constants.sensor_responsiveness, 4);
+    SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF ", constants.ambient_xfer_coeff_fan0, 4);
+    #if ENABLED(MPC_INCLUDE_FAN)
+      SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF_FAN255 ", constants.ambient_xfer_coeff_fan0 + constants.fan255_adjustment, 4);
+    #endif
+  }
+
+#endif // MPCTEMP
+
 /**
  * Class and Instance Methods
  */
@@ -922,6 +1195,67 @@ void Temperature::min_temp_error(const heater_ind_t heater) {
         }
       #endif // PID_DEBUG
 
+    #elif ENABLED(MPCTEMP)
+
+      MPCHeaterInfo &hotend = temp_hotend[ee];
+      const MPC_t &constants = hotend.constants;
+
+      // At startup, initialize the modeled temperatures
+      if (isnan(hotend.modeled_block_temp)) {
+        hotend.modeled_ambient_temp = _MIN(30.0f, hotend.celsius); // Cap at a reasonable room temperature
+        hotend.modeled_block_temp = hotend.modeled_sensor_temp = hotend.celsius;
+      }
+
+      #if HOTENDS == 1
+        constexpr bool this_hotend = true;
+      #else
+        const bool this_hotend = (ee == active_extruder);
+      #endif
+
+      // Filament fed since the last sample
+      float e_speed = 0;
+      if (this_hotend) {
+        const int32_t e_position = stepper.position(E_AXIS);
+        if (e_position > mpc_e_position) e_speed = (e_position - mpc_e_position) * planner.steps_to_mm[E_AXIS_N(ee)] / MPC_dT;
+        mpc_e_position = e_position;
+      }
+
+      float ambient_xfer_coeff = constants.ambient_xfer_coeff_fan0;
+      #if ENABLED(MPC_INCLUDE_FAN)
+        ambient_xfer_coeff += fan_speed[ee < (FAN_COUNT) ? ee : 0] * constants.fan255_adjustment * RECIPROCAL(255);
+      #endif
+
+      // Advance the model by one sample period
+      const float blocktempdelta = (hotend.soft_pwm_amount * constants.heater_power * (1.0f / 127)
+                                   - (ambient_xfer_coeff + e_speed * constants.filament_heat_capacity_permm) * (hotend.modeled_block_temp - hotend.modeled_ambient_temp)
+                                   ) * MPC_dT / constants.block_heat_capacity;
+      hotend.modeled_block_temp += blocktempdelta;
+      hotend.modeled_sensor_temp += (hotend.modeled_block_temp - hotend.modeled_sensor_temp) * (constants.sensor_responsiveness * MPC_dT);
+
+      // Any difference from the measured temperature is slow model error or fast noise.
+      // Correct towards the measurement a little at a time so the noise averages out.
+      const float delta_to_apply = (hotend.celsius - hotend.modeled_sensor_temp) * (MPC_SMOOTHING_FACTOR);
+      hotend.modeled_block_temp += delta_to_apply;
+      hotend.modeled_sensor_temp += delta_to_apply;
+
+      // Correct the ambient temperature only near steady state, when the output isn't clipped
+      if (WITHIN(hotend.soft_pwm_amount, 1, 126) || ABS(blocktempdelta + delta_to_apply) < (MPC_STEADYSTATE) * MPC_dT)
+        hotend.modeled_ambient_temp += delta_to_apply > 0 ? _MAX(delta_to_apply, (MPC_MIN_AMBIENT_CHANGE) * MPC_dT)
+                                                          : _MIN(delta_to_apply, -(MPC_MIN_AMBIENT_CHANGE) * MPC_dT);
+
+      float power = 0;
+      if (hotend.target != 0 && TERN1(HEATER_IDLE_HANDLER, !hotend_idle[ee].timed_out)) {
+        // Plan the power to reach the target in 2 seconds...
+        power = (hotend.target - hotend.modeled_block_temp) * constants.block_heat_capacity * 0.5f;
+        // ...and to cover the losses to the air and to the filament about to be extruded
+        const float planned_e_speed = planner.extrusion_speed_ahead(ee, MPC_FLOW_LOOKAHEAD);
+        power += (hotend.target - hotend.modeled_ambient_temp) * (ambient_xfer_coeff + planned_e_speed * constants.filament_heat_capacity_permm);
+      }
+
+      // Round up so the output quantizes correctly into 0..127
+      float pid_output = power * 254.0f / constants.heater_power + 1.0f;
+      LIMIT(pid_output, 0, MPC_MAX);
+
     #else // No PID enabled
 
       const bool is_idling = TERN0(HEATER_IDLE_HANDLER, hotend_idle[ee].timed_out);
@@ -1627,6 +1961,10 @@ void Temperature::init() {
     last_e_position = 0;
   #endif
 
+  #if ENABLED(MPCTEMP)
+    HOTEND_LOOP() temp_hotend[e].modeled_block_temp = NAN;
+  #endif
+
   #if HAS_HEATER_0
     #ifdef ALFAWISE_UX0
       OUT_WRITE_OD(HEATER_0_PIN, HEATER_0_INVERTING);
@@ -2368,7 +2706,9 @@ void Temperature::readings_ready() {
 HAL_TEMP_TIMER_ISR() {
   HAL_timer_isr_prologue(TEMP_TIMER_NUM);
 
+  TERN_(STEPPER_TRACE, stepper_trace.log(TRACE_TEMP_ENTER));
   Temperature::tick();
+  TERN_(STEPPER_TRACE, stepper_trace.log(TRACE_TEMP_EXIT));
 
   HAL_timer_isr_epilogue(TEMP_TIMER_NUM);
 }
@@ -2862,7 +3202,7 @@ void Temperature::tick() {
   // Additional ~1KHz Tasks
   //
 
-  #if ENABLED(BABYSTEPPING) && DISABLED(INTEGRATED_BABYSTEPPING)
+  #if ENABLED(BABYSTEPPING) && NONE(INTEGRATED_BABYSTEPPING, BABYSTEP_PLANNED)
     babystep.task();
   #endif
 
@@ -97,6 +97,10 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #include "../feature/tool_preheat.h"
+#endif
+
 #if ENABLED(TOOLCHANGE_FILAMENT_SWAP)
   #include "../gcode/gcode.h"
   #if TOOLCHANGE_FS_WIPE_RETRACT <= 0
@@ -159,6 +163,17 @@ inline void _line_to_current(const AxisEnum fr_axis, const float fscale=1) {
 inline void slow_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.5f); }
 inline void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis); }
 
+#if ENABLED(TOOLCHANGE_QUEUED_MOVES)
+  // Leave the generic tool-change moves in the planner. Hardware actions still wait for them.
+  #define toolchange_sync()                 NOOP
+  #define toolchange_e_move(L,F)            unscaled_e_move(L, F, false)
+  #define toolchange_move_to(X,Y,Z,F)       do_queued_move_to(X, Y, Z, F)
+#else
+  #define toolchange_sync()                 planner.synchronize()
+  #define toolchange_e_move(L,F)            unscaled_e_move(L, F)
+  #define toolchange_move_to(X,Y,Z,F)       do_blocking_move_to(X, Y, Z, F)
+#endif
+
 #if ENABLED(MAGNETIC_PARKING_EXTRUDER)
 
   float parkingposx[2],           // M951 R L
@@ -782,7 +797,7 @@ void tool_change_prime() {
         NOMORE(current_position.z, soft_endstop.max.z);
       #endif
       fast_line_to_current(Z_AXIS);
-      planner.synchronize();
+      toolchange_sync();
     }
 
     // Park
@@ -791,20 +806,21 @@ void tool_change_prime() {
         TERN(TOOLCHANGE_PARK_Y_ONLY,,current_position.x = toolchange_settings.change_point.x);
         TERN(TOOLCHANGE_PARK_X_ONLY,,current_position.y = toolchange_settings.change_point.y);
         planner.buffer_line(current_position, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE), active_extruder);
-        planner.synchronize();
+        toolchange_sync();
       }
     #endif
 
     // Prime (All distances are added and slowed down to ensure secure priming in all circumstances)
-    unscaled_e_move(toolchange_settings.swap_length + toolchange_settings.extra_prime, MMM_TO_MMS(toolchange_settings.prime_speed));
+    toolchange_e_move(toolchange_settings.swap_length + toolchange_settings.extra_prime, MMM_TO_MMS(toolchange_settings.prime_speed));
 
     // Cutting retraction
     #if TOOLCHANGE_FS_WIPE_RETRACT
-      unscaled_e_move(-(TOOLCHANGE_FS_WIPE_RETRACT), MMM_TO_MMS(toolchange_settings.retract_speed));
+      toolchange_e_move(-(TOOLCHANGE_FS_WIPE_RETRACT), MMM_TO_MMS(toolchange_settings.retract_speed));
     #endif
 
-    // Cool down with fan
+    // Cool down with fan, once the moves before it are done
     #if HAS_FAN && TOOLCHANGE_FS_FAN >= 0
+      planner.synchronize();
       thermalManager.fan_speed[TOOLCHANGE_FS_FAN] = toolchange_settings.fan_speed;
       gcode.dwell(toolchange_settings.fan_time * 1000);
       thermalManager.fan_speed[TOOLCHANGE_FS_FAN] = 0;
@@ -814,17 +830,17 @@ void tool_change_prime() {
     #if ENABLED(TOOLCHANGE_PARK)
       if (ok) {
         #if ENABLED(TOOLCHANGE_NO_RETURN)
-          do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
+          toolchange_move_to(current_position.x, current_position.y, destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
         #else
-          do_blocking_move_to(destination, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
+          toolchange_move_to(destination.x, destination.y, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
         #endif
       }
     #endif
 
     // Cutting recover
-    unscaled_e_move(toolchange_settings.extra_resume + TOOLCHANGE_FS_WIPE_RETRACT, MMM_TO_MMS(toolchange_settings.unretract_speed));
+    toolchange_e_move(toolchange_settings.extra_resume + TOOLCHANGE_FS_WIPE_RETRACT, MMM_TO_MMS(toolchange_settings.unretract_speed));
 
-    planner.synchronize();
+    toolchange_sync();
     current_position.e = destination.e;
     sync_plan_position_e(); // Resume at the old E position
   }
@@ -872,7 +888,10 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
 
   #else // EXTRUDERS > 1
 
-    planner.synchronize();
+    // The IDEX carriage switch acts right away
+    #if DISABLED(TOOLCHANGE_QUEUED_MOVES) || ENABLED(DUAL_X_CARRIAGE)
+      planner.synchronize();
+    #endif
 
     #if ENABLED(DUAL_X_CARRIAGE)  // Only T0 allowed if the Printer is in DXC_DUPLICATION_MODE or DXC_MIRRORED_MODE
       if (new_tool != 0 && dxc_is_duplicating())
@@ -916,6 +935,8 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
     if (new_tool != old_tool) {
       destination = current_position;
 
+      TERN_(TOOLCHANGE_PREHEAT, tool_preheat.select(new_tool));
+
       #if BOTH(TOOLCHANGE_FILAMENT_SWAP, HAS_FAN) && TOOLCHANGE_FS_FAN >= 0
         // Store and stop fan. Restored on any exit.
         REMEMBER(fan, thermalManager.fan_speed[TOOLCHANGE_FS_FAN], 0);
@@ -930,7 +951,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             NOMORE(current_position.z, soft_endstop.max.z);
           #endif
           fast_line_to_current(Z_AXIS);
-          planner.synchronize();
+          toolchange_sync();
         }
       #endif
 
@@ -949,13 +970,15 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             #if ENABLED(TOOLCHANGE_FS_PRIME_FIRST_USED)
               // For first new tool, change without unloading the old. 'Just prime/init the new'
               if (first_tool_is_primed)
-                unscaled_e_move(-toolchange_settings.swap_length, MMM_TO_MMS(toolchange_settings.retract_speed));
+                toolchange_e_move(-toolchange_settings.swap_length, MMM_TO_MMS(toolchange_settings.retract_speed));
               first_tool_is_primed = true; // The first new tool will be primed by toolchanging
             #endif
           }
         }
       #endif
 
+      TERN_(TOOLCHANGE_PREHEAT, tool_preheat.standby(old_tool));
+
       TERN_(SWITCHING_NOZZLE_TWO_SERVOS, raise_nozzle(old_tool));
 
       REMEMBER(fr, feedrate_mm_s, XY_PROBE_FEEDRATE_MM_S);
@@ -990,7 +1013,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
           TERN(TOOLCHANGE_PARK_Y_ONLY,,current_position.x = toolchange_settings.change_point.x);
           TERN(TOOLCHANGE_PARK_X_ONLY,,current_position.y = toolchange_settings.change_point.y);
           planner.buffer_line(current_position, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE), old_tool);
-          planner.synchronize();
+          toolchange_sync();
         }
       #endif
 
@@ -1050,6 +1073,9 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
         constexpr bool safe_to_move = true;
       #endif
 
+      // The new tool may still be heating from standby, moving or not
+      TERN_(TOOLCHANGE_PREHEAT, tool_preheat.ready(new_tool));
+
       // Return to position and lower again
       const bool should_move = safe_to_move && !no_move && IsRunning();
       if (should_move) {
@@ -1078,23 +1104,24 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
               if (!toolchange_extruder_ready[new_tool]) {
                 toolchange_extruder_ready[new_tool] = true;
                 fr = toolchange_settings.prime_speed;       // Next move is a prime
-                unscaled_e_move(0, MMM_TO_MMS(fr));         // Init planner with 0 length move
+                toolchange_e_move(0, MMM_TO_MMS(fr));       // Init planner with 0 length move
               }
             #endif
 
             // Unretract (or Prime)
-            unscaled_e_move(toolchange_settings.swap_length, MMM_TO_MMS(fr));
+            toolchange_e_move(toolchange_settings.swap_length, MMM_TO_MMS(fr));
 
             // Extra Prime
-            unscaled_e_move(toolchange_settings.extra_prime, MMM_TO_MMS(toolchange_settings.prime_speed));
+            toolchange_e_move(toolchange_settings.extra_prime, MMM_TO_MMS(toolchange_settings.prime_speed));
 
             // Cutting retraction
             #if TOOLCHANGE_FS_WIPE_RETRACT
-              unscaled_e_move(-(TOOLCHANGE_FS_WIPE_RETRACT), MMM_TO_MMS(toolchange_settings.retract_speed));
+              toolchange_e_move(-(TOOLCHANGE_FS_WIPE_RETRACT), MMM_TO_MMS(toolchange_settings.retract_speed));
             #endif
 
-            // Cool down with fan
+            // Cool down with fan, once the moves before it are done
             #if HAS_FAN && TOOLCHANGE_FS_FAN >= 0
+              planner.synchronize();
               thermalManager.fan_speed[TOOLCHANGE_FS_FAN] = toolchange_settings.fan_speed;
               gcode.dwell(toolchange_settings.fan_time * 1000);
               thermalManager.fan_speed[TOOLCHANGE_FS_FAN] = 0;
@@ -1123,17 +1150,17 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             #if ENABLED(TOOLCHANGE_PARK)
               if (toolchange_settings.enable_park)
             #endif
-            do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
+            toolchange_move_to(current_position.x, current_position.y, destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
 
           #else
             // Move back to the original (or adjusted) position
             DEBUG_POS("Move back", destination);
 
             #if ENABLED(TOOLCHANGE_PARK)
-              if (toolchange_settings.enable_park) do_blocking_move_to_xy_z(destination, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
+              if (toolchange_settings.enable_park) toolchange_move_to(destination.x, destination.y, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
             #else
-              do_blocking_move_to_xy(destination, planner.settings.max_feedrate_mm_s[X_AXIS]);
-              do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
+              toolchange_move_to(destination.x, destination.y, current_position.z, planner.settings.max_feedrate_mm_s[X_AXIS]);
+              toolchange_move_to(current_position.x, current_position.y, destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
             #endif
 
           #endif
@@ -1144,7 +1171,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
         #if ENABLED(TOOLCHANGE_FILAMENT_SWAP)
           if (should_swap && !too_cold) {
             // Cutting recover
-            unscaled_e_move(toolchange_settings.extra_resume + TOOLCHANGE_FS_WIPE_RETRACT, MMM_TO_MMS(toolchange_settings.unretract_speed));
+            toolchange_e_move(toolchange_settings.extra_resume + TOOLCHANGE_FS_WIPE_RETRACT, MMM_TO_MMS(toolchange_settings.unretract_speed));
             current_position.e = 0;
             sync_plan_position_e(); // New extruder primed and set to 0
 
@@ -1161,7 +1188,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
       #if ENABLED(SWITCHING_NOZZLE)
         // Move back down. (Including when the new tool is higher.)
         if (!should_move)
-          do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
+          toolchange_move_to(current_position.x, current_position.y, destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
       #endif
 
       TERN_(PRUSA_MMU2, mmu2.tool_change(new_tool));
@@ -1170,7 +1197,10 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
 
     } // (new_tool != old_tool)
 
-    planner.synchronize();
+    // Solenoids, the stepper multiplexer and the fan multiplexer switch right away
+    #if DISABLED(TOOLCHANGE_QUEUED_MOVES) || ANY(EXT_SOLENOID, MK2_MULTIPLEXER, HAS_FANMUX)
+      planner.synchronize();
+    #endif
 
     #if ENABLED(EXT_SOLENOID) && DISABLED(PARKING_EXTRUDER)
       disable_all_solenoids();
@@ -1060,6 +1060,47 @@ int16_t SdBaseFile::read(void* buf, uint16_t nbyte) {
   return nbyte;
 }
 
+/**
+ * Get the cached bytes from the current position to the end of
+ * its block, without copying and without advancing the position.
+ * Consume them with seekCur(). Any other access to the volume may
+ * replace the cache, so finish with \a data before that.
+ *
+ * \param[out] data Set to point into the volume's block cache.
+ *
+ * \return The number of bytes at \a data, zero at end of file,
+ * or -1 for an error.
+ */
+int16_t SdBaseFile::peekBlock(const uint8_t* &data) {
+  uint32_t block;  // raw device block number
+
+  // error if not open or write only
+  if (!isOpen() || !(flags_ & O_READ)) return -1;
+
+  if (curPosition_ >= fileSize_) return 0;
+
+  const uint16_t offset = curPosition_ & 0x1FF;  // offset in block
+  if (type_ == FAT_FILE_TYPE_ROOT_FIXED) {
+    block = vol_->rootDirStart() + (curPosition_ >> 9);
+  }
+  else {
+    // Same as read(), but the next cluster is left for seekSet() to follow
+    const uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+    uint32_t cluster = curCluster_;
+    if (offset == 0 && blockOfCluster == 0) {
+      if (curPosition_ == 0)
+        cluster = firstCluster_;
+      else if (!vol_->fatGet(curCluster_, &cluster))
+        return -1;
+    }
+    block = vol_->clusterStartBlock(cluster) + blockOfCluster;
+  }
+
+  if (!vol_->cacheRawBlock(block, SdVolume::CACHE_FOR_READ)) return -1;
+  data = vol_->cache()->data + offset;
+  return _MIN(uint32_t(512 - offset), fileSize_ - curPosition_);
+}
+
 /**
  * Read the next entry in a directory.
  *
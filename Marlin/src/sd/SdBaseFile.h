@@ -302,6 +302,7 @@ class SdBaseFile {
   int16_t read();
   int16_t read(void* buf, uint16_t nbyte);
   int8_t readDir(dir_t* dir, char* longFilename);
+  int16_t peekBlock(const uint8_t* &data);
   static bool remove(SdBaseFile* dirFile, const char* path);
   bool remove();
 
@@ -51,6 +51,10 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(UBL_PRINT_AREA_PROBING)
+  #include "../feature/bedlevel/bedlevel.h"
+#endif
+
 // public:
 
 card_flags_t CardReader::flag;
@@ -111,6 +115,9 @@ uint8_t CardReader::workDirDepth;
 Sd2Card CardReader::sd2card;
 SdVolume CardReader::volume;
 SdFile CardReader::file;
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  SdFile CardReader::lookahead;
+#endif
 
 uint8_t CardReader::file_subcall_ctr;
 uint32_t CardReader::filespos[SD_PROCEDURE_DEPTH];
@@ -508,6 +515,44 @@ void announceOpen(const uint8_t doing, const char * const path) {
   }
 }
 
+#if ENABLED(UBL_PRINT_AREA_PROBING)
+
+  /**
+   * Look for the job's XY extents near the top of the file, in the form
+   * Cura writes them (;MINX:12.3 ;MINY: ;MAXX: ;MAXY:). Only the first
+   * two blocks are read so opening a file stays quick.
+   */
+  static void scan_print_area(SdFile &file) {
+    xy_pos_t amin{0}, amax{0};
+    uint8_t found = 0;
+    char line[24];
+    uint8_t len = 0;
+    for (uint16_t n = 0; n < 1024 && found != 0x0F; n++) {
+      const int16_t c = file.read();
+      if (c < 0) break;
+      if (c == '\n' || c == '\r') {
+        line[len] = '\0';
+        if (len > 6 && line[0] == ';' && line[1] == 'M' && line[5] == ':' && (line[4] == 'X' || line[4] == 'Y')) {
+          const bool is_y = line[4] == 'Y';
+          const float v = atof(&line[6]);
+          if (line[2] == 'I' && line[3] == 'N')      { amin[is_y] = v; SBI(found, is_y); }
+          else if (line[2] == 'A' && line[3] == 'X') { amax[is_y] = v; SBI(found, 2 + is_y); }
+        }
+        len = 0;
+      }
+      else if (len < COUNT(line) - 1)
+        line[len++] = c;
+    }
+    file.seekSet(0);
+
+    if (found == 0x0F)
+      ubl.set_print_area(amin, amax);
+    else
+      ubl.clear_print_area();
+  }
+
+#endif
+
 //
 // Open a file by DOS path for read
 // The 'subcall_type' flag indicates...
@@ -562,6 +607,8 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
     filesize = file.fileSize();
     sdpos = 0;
 
+    TERN_(UBL_PRINT_AREA_PROBING, if (subcall_type == 0) scan_print_area(file));
+
     PORT_REDIRECT(SERIAL_BOTH);
     SERIAL_ECHOLNPAIR(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
     SERIAL_ECHOLNPGM(STR_SD_FILE_SELECTED);
@@ -1106,6 +1153,7 @@ void CardReader::fileHasFinished() {
   }
   else {
     endFilePrint(TERN_(SD_RESORT, true));
+    TERN_(UBL_PRINT_AREA_PROBING, ubl.clear_print_area()); // Don't apply this job's area to the next one
 
     marlin_state = MF_SD_COMPLETE;
   }
@@ -157,13 +157,22 @@ public:
   static inline bool isFileOpen() { return isMounted() && file.isOpen(); }
   static inline uint32_t getIndex() { return sdpos; }
   static inline uint32_t getFileSize() { return filesize; }
+  static inline bool getFileDirEntry(dir_t &dir) { return file.dirEntry(&dir); }
   static inline bool eof() { return sdpos >= filesize; }
   static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
   static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
   static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  static inline int16_t peek_block(const uint8_t* &data) { sdpos = file.curPosition(); return file.peekBlock(data); }
+  static inline void consume(const uint16_t n) { file.seekCur(n); sdpos = file.curPosition(); }
   static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
 
+  #if ENABLED(TOOLCHANGE_PREHEAT)
+    // Read further along the open file without moving the print position
+    static inline void read_ahead_start(const uint32_t index) { lookahead = file; lookahead.seekSet(index); }
+    static inline int16_t read_ahead(void* buf, uint16_t nbyte) { return file.isOpen() ? lookahead.read(buf, nbyte) : -1; }
+  #endif
+
   static Sd2Card& getSd2Card() { return sd2card; }
 
   #if ENABLED(AUTO_REPORT_SD_STATUS)
@@ -242,6 +251,9 @@ private:
   static Sd2Card sd2card;
   static SdVolume volume;
   static SdFile file;
+  #if ENABLED(TOOLCHANGE_PREHEAT)
+    static SdFile lookahead;
+  #endif
 
   static uint32_t filesize, sdpos;
 
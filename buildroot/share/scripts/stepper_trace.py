@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+#
+# for python3.5 or higher
+#-----------------------------------
+# Decode a STEPPER_TRACE dump (M936) or a Linux HAL GPIO log (all_gpio_log.trace)
+# into Chrome trace-event JSON, viewable in chrome://tracing or ui.perfetto.dev.
+#
+# Records are 8 bytes, little-endian, as defined in Marlin/src/core/trace.h:
+#    uint32 time, uint8 event, uint8 flags, uint16 value
+#
+# Invocation:
+#-------------
+#   python3 stepper_trace.py capture.txt [-o trace.json] [--stats]
+#
+# The input may be a serial capture containing the lines between TRACE_BEGIN
+# and TRACE_END (other lines are ignored) or a binary file of raw records.
+#-----------------------------------
+#
+import sys
+import json
+import struct
+import argparse
+
+TRACE_HEADER, TRACE_STEP_ISR, TRACE_STEP_INTERVAL, TRACE_BLOCK_START, \
+TRACE_BLOCK_END, TRACE_TEMP_ENTER, TRACE_TEMP_EXIT, TRACE_GPIO = range(8)
+
+GPIO_TYPES = ['NOP', 'FALL', 'RISE', 'SET_VALUE', 'SETM', 'SETD']
+
+def read_records(path):
+    data = open(path, 'rb').read()
+    if b'TRACE_BEGIN' in data:
+        raw = bytearray()
+        inside = False
+        for line in data.decode('ascii', 'replace').splitlines():
+            line = line.strip()
+            if line.startswith('TRACE_BEGIN'): inside = True; raw.clear()
+            elif line.startswith('TRACE_END'): inside = False
+            elif inside and len(line) == 16: raw += bytes.fromhex(line)
+        data = bytes(raw)
+    return [struct.unpack_from('<IBBH', data, i) for i in range(0, len(data) - 7, 8)]
+
+def decode(records):
+    """Return (events, stats) with 32-bit timestamps unwrapped to float microseconds."""
+    rate, timer_khz = 1000000, 0
+    events, isr_times, intervals, temp_times = [], [], [], []
+    isr_start = temp_start = block_start = None
+    last, base = None, 0
+
+    for time, event, flags, value in records:
+        if event == TRACE_HEADER:
+            rate, timer_khz = time or rate, value
+            continue
+        if last is not None and time < last: base += 1 << 32
+        last = time
+        ts = (base + time) * 1000000.0 / rate
+
+        if event == TRACE_STEP_ISR:
+            isr_start = ts
+        elif event == TRACE_STEP_INTERVAL:
+            args = {'loops': flags, 'next_ticks': value}
+            if timer_khz: args['next_us'] = value * 1000.0 / timer_khz
+            if isr_start is not None:
+                events.append({'name': 'stepper isr', 'ph': 'X', 'ts': isr_start, 'dur': ts - isr_start, 'pid': 0, 'tid': 0, 'args': args})
+                isr_times.append(ts - isr_start)
+            intervals.append(value)
+            isr_start = None
+        elif event == TRACE_BLOCK_START:
+            block_start = (ts, value)
+        elif event == TRACE_BLOCK_END:
+            if block_start is not None:
+                events.append({'name': 'block', 'ph': 'X', 'ts': block_start[0], 'dur': ts - block_start[0], 'pid': 0, 'tid': 1, 'args': {'steps': block_start[1]}})
+            block_start = None
+        elif event == TRACE_TEMP_ENTER:
+            temp_start = ts
+        elif event == TRACE_TEMP_EXIT:
+            if temp_start is not None:
+                events.append({'name': 'temperature isr', 'ph': 'X', 'ts': temp_start, 'dur': ts - temp_start, 'pid': 0, 'tid': 2})
+                temp_times.append(ts - temp_start)
+            temp_start = None
+        elif event == TRACE_GPIO:
+            kind = GPIO_TYPES[flags] if flags < len(GPIO_TYPES) else str(flags)
+            events.append({'name': 'pin %d %s' % (value, kind), 'ph': 'i', 's': 't', 'ts': ts, 'pid': 0, 'tid': 3})
+
+    names = [
+        {'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': t, 'args': {'name': n}}
+        for t, n in enumerate(['Stepper ISR', 'Blocks', 'Temperature ISR', 'GPIO'])
+    ]
+    return names + events, (isr_times, intervals, temp_times)
+
+def summary(name, values, unit):
+    if not values: return
+    values = sorted(values)
+    mean = sum(values) / len(values)
+    print('%-16s n=%-6d min=%.2f mean=%.2f p99=%.2f max=%.2f %s' % (
+        name, len(values), values[0], mean, values[min(len(values) - 1, int(len(values) * 0.99))], values[-1], unit))
+
+def main():
+    ap = argparse.ArgumentParser(description='Decode a Marlin stepper trace into Chrome trace-event JSON.')
+    ap.add_argument('input', help='Serial capture of M936 output, or a binary trace file')
+    ap.add_argument('-o', '--output', default='trace.json', help='JSON output file (default: trace.json)')
+    ap.add_argument('--stats', action='store_true', help='Print ISR duration and interval statistics')
+    args = ap.parse_args()
+
+    records = read_records(args.input)
+    if not records:
+        sys.exit('No trace records found in ' + args.input)
+
+    events, (isr_times, intervals, temp_times) = decode(records)
+    with open(args.output, 'w') as f:
+        json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, f)
+    print('%d records -> %s' % (len(records), args.output))
+
+    if args.stats:
+        summary('stepper isr', isr_times, 'us')
+        summary('next interval', intervals, 'ticks')
+        summary('temperature isr', temp_times, 'us')
+
+if __name__ == '__main__':
+    main()